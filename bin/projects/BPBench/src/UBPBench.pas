@@ -21,10 +21,16 @@ procedure RunBench();
 
 implementation
 
-{$IFNDEF BLAISEPASCAL}
+{$IFDEF BLAISEPASCAL}
+uses
+  StrUtils;
+{$ELSE}
 uses
   WinApi.Windows,
-  System.SysUtils;
+  System.SysUtils,
+  System.StrUtils,
+  System.Math,
+  System.Generics.Collections;
 {$ENDIF}
 
 const
@@ -39,6 +45,14 @@ type
     BytesProcessed: Double;
   end;
 
+  TDoubleArray = array of Double;
+{$IFDEF BLAISEPASCAL}
+  TDoubleGrid = TMatrix<Double>;
+{$ELSE}
+  TDoubleGrid = array of array of Double;
+{$ENDIF}
+  TIntegerArray = array of Integer;
+
 var
   GSink: Int64;
 
@@ -349,6 +363,424 @@ begin
     Write('');
 end;
 
+function PassString(AStr: string): string;
+begin
+  Result := AStr;
+end;
+
+procedure Bench_StringPass_100k(var ABytesProcessed: Double);
+var
+  LSrc: string;
+  LDst: string;
+  LIndex: Integer;
+begin
+  LSrc := StringOfChar('x', 256);
+  LDst := '';
+  LIndex := 1;
+  while LIndex <= 100000 do
+  begin
+    LDst := PassString(LSrc);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 100000.0 * 256.0 * 2.0;
+  if Length(LDst) = 0 then
+    Write('');
+end;
+
+procedure Bench_StringCompare_100k(var ABytesProcessed: Double);
+var
+  LKeyA: string;
+  LKeyB: string;
+  LPadded: string;
+  LHay: string;
+  LNeedle: string;
+  LIndex: Integer;
+  LHits: Integer;
+begin
+  LKeyA := 'customer_record_key_identifier_00000000000000000000000000042';
+  LKeyB := 'CUSTOMER_RECORD_KEY_IDENTIFIER_00000000000000000000000000042';
+  LPadded := '   ' + LKeyA + '   ';
+  LHay := StringOfChar('x', 240) + 'needle' + StringOfChar('y', 10);
+  LNeedle := 'needle';
+  LHits := 0;
+  LIndex := 1;
+  while LIndex <= 100000 do
+  begin
+    if SameText(LKeyA, LKeyB) then
+      Inc(LHits);
+    if CompareStr(LKeyA, LKeyB) > 0 then
+      Inc(LHits);
+    LHits := LHits + Pos(LNeedle, LHay);
+    LHits := LHits + Length(Trim(LPadded));
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 100000.0 * (60.0 * 2.0 + 256.0 + 66.0) * 2.0;
+  GSink := LHits;
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_StrUtils_10k(var ABytesProcessed: Double);
+var
+  LText: string;
+  LIndex: Integer;
+  LHits: Integer;
+begin
+  LText := StringOfChar('a', 200) + 'Hello World';
+  LHits := 0;
+  LIndex := 1;
+  while LIndex <= 10000 do
+  begin
+    LHits := LHits + Length(ReverseString(LText));
+    LHits := LHits + Length(DupeString('abc', 100));
+    LHits := LHits + Length(StuffString(LText, 50, 10, 'xyz'));
+    if ContainsText(LText, 'WORLD') then
+      Inc(LHits);
+    if StartsText('AAA', LText) then
+      Inc(LHits);
+    if EndsText('WORLD', LText) then
+      Inc(LHits);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 10000.0 * (211.0 + 300.0 + 204.0 + 211.0 + 3.0 + 5.0) * 2.0;
+  GSink := LHits;
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_ConcatChain_10k(var ABytesProcessed: Double);
+var
+  LName: string;
+  LLine: string;
+  LText: string;
+  LIndex: Integer;
+begin
+  LName := 'Blaise';
+  LText := '';
+  LIndex := 1;
+  while LIndex <= 10000 do
+  begin
+    LLine := 'item ' + IntToStr(LIndex) + ': ' + LName + ' = ' + IntToStr(LIndex * 2);
+    LText := LText + LLine + ',';
+    Inc(LIndex);
+  end;
+  ABytesProcessed := (243343.0 + 253343.0) * 2.0;
+  GSink := Length(LText);
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_LogProcess_10k(var ABytesProcessed: Double);
+var
+  LLevel: string;
+  LLine: string;
+  LReport: string;
+  LIndex: Integer;
+  LStart: Integer;
+  LHits: Integer;
+begin
+  LReport := '';
+  LHits := 0;
+  LIndex := 1;
+  while LIndex <= 10000 do
+  begin
+    if LIndex mod 50 = 0 then
+      LLevel := 'ERROR'
+    else
+      LLevel := 'INFO';
+    LLine := '2025-10-17 12:34:56.789 ' + LLevel + ' [worker-' + IntToStr(LIndex mod 8) + '] GET /api/v1/items/' + IntToStr(LIndex) + ' status=200 took=' + IntToStr(LIndex mod 97) + 'ms';
+    if Pos('ERROR', LLine) > 0 then
+    begin
+      LStart := Pos('GET ', LLine);
+      LReport := LReport + Copy(LLine, LStart, Length(LLine) - LStart + 1) + ',';
+    end;
+    if ContainsText(LLine, 'TOOK=9') then
+      Inc(LHits);
+    LHits := LHits + Length(Trim(Copy(LLine, 25, 8)));
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 828055.0 * 2.0;
+  GSink := LHits + Length(LReport);
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_CaseConvert_10k(var ABytesProcessed: Double);
+var
+  LText: string;
+  LUpper: string;
+  LIndex: Integer;
+  LHits: Integer;
+begin
+  LText := 'Grüße aus Köln: The quick brown fox jumps over the lazy dog';
+  LUpper := AnsiUpperCase(LText);
+  LHits := 0;
+  LIndex := 1;
+  while LIndex <= 10000 do
+  begin
+    LHits := LHits + Length(UpperCase(LText));
+    LHits := LHits + Length(AnsiUpperCase(LText));
+    LHits := LHits + Length(AnsiLowerCase(LUpper));
+    if AnsiSameText(LText, LUpper) then
+      Inc(LHits);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 10000.0 * 59.0 * 8.0 * 2.0;
+  GSink := LHits;
+  if GSink = 0 then
+    Write('');
+end;
+
+function ArrayPassLeaf(AValues: TDoubleArray; const AIndex: Integer): Double;
+begin
+  Result := AValues[AIndex mod Length(AValues)];
+end;
+
+function ArrayPassMiddle(AValues: TDoubleArray; const AIndex: Integer): Double;
+begin
+  Result := ArrayPassLeaf(AValues, AIndex) + ArrayPassLeaf(AValues, AIndex + 1);
+end;
+
+function ArrayPassTop(AValues: TDoubleArray; const AIndex: Integer): Double;
+begin
+  Result := ArrayPassMiddle(AValues, AIndex) + 1.0;
+end;
+
+procedure Bench_ArrayPass_10k(var ABytesProcessed: Double);
+var
+  LValues: TDoubleArray;
+  LIndex: Integer;
+  LSum: Double;
+begin
+  SetLength(LValues, 4096);
+  LIndex := 0;
+  while LIndex <= 4095 do
+  begin
+    LValues[LIndex] := LIndex * 0.5;
+    Inc(LIndex);
+  end;
+  LSum := 0.0;
+  LIndex := 1;
+  while LIndex <= 10000 do
+  begin
+    LSum := LSum + ArrayPassTop(LValues, LIndex);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 10000.0 * 4.0 * 4096.0 * 8.0;
+  GSink := Trunc(LSum);
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_ArraySlice_1k(var ABytesProcessed: Double);
+var
+  LValues: TDoubleArray;
+  LSlice: TDoubleArray;
+  LJoined: TDoubleArray;
+  LIndex: Integer;
+  LFirst: Double;
+  LSum: Double;
+begin
+  SetLength(LValues, 65537);
+  LIndex := 0;
+  while LIndex <= 65536 do
+  begin
+    LValues[LIndex] := LIndex * 0.25;
+    Inc(LIndex);
+  end;
+  LSum := 0.0;
+  LIndex := 1;
+  while LIndex <= 1000 do
+  begin
+    LSlice := Copy(LValues, 1, 65536);
+    Delete(LSlice, 0, 1);
+    LFirst := LIndex * 0.5;
+    Insert(LFirst, LSlice, 0);
+    LJoined := Concat(LSlice, LSlice);
+    LSum := LSum + LJoined[LIndex] + Length(LJoined);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 1000.0 * 65536.0 * 8.0 * 5.0;
+  GSink := Trunc(LSum);
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_GridBlur_512(var ABytesProcessed: Double);
+var
+  LGrid: TDoubleGrid;
+  LBlurred: TDoubleGrid;
+  LRow: Integer;
+  LCol: Integer;
+begin
+  SetLength(LGrid, 512, 512);
+  SetLength(LBlurred, 512, 512);
+  LRow := 0;
+  while LRow <= 511 do
+  begin
+    LCol := 0;
+    while LCol <= 511 do
+    begin
+      LGrid[LRow, LCol] := (LRow xor LCol) * 0.5;
+      Inc(LCol);
+    end;
+    Inc(LRow);
+  end;
+
+  LRow := 1;
+  while LRow <= 510 do
+  begin
+    LCol := 1;
+    while LCol <= 510 do
+    begin
+      LBlurred[LRow, LCol] := (LGrid[LRow - 1, LCol] + LGrid[LRow + 1, LCol] +
+        LGrid[LRow, LCol - 1] + LGrid[LRow, LCol + 1]) * 0.25;
+      Inc(LCol);
+    end;
+    Inc(LRow);
+  end;
+
+  ABytesProcessed := 512.0 * 512.0 * 8.0 * 3.0;
+  GSink := Trunc(LBlurred[255, 255]);
+  if GSink < 0 then
+    Write('');
+end;
+
+function OpenArrayPeek(const AValues: array of Double; const AIndex: Integer): Double;
+begin
+  Result := AValues[AIndex mod Length(AValues)] + High(AValues);
+end;
+
+procedure Bench_OpenArray_1M(var ABytesProcessed: Double);
+var
+  LValues: TDoubleArray;
+  LIndex: Integer;
+  LSum: Double;
+begin
+  SetLength(LValues, 1048576);
+  LIndex := 0;
+  while LIndex <= 1048575 do
+  begin
+    LValues[LIndex] := LIndex * 0.5;
+    Inc(LIndex);
+  end;
+  LSum := 0.0;
+  LIndex := 1;
+  while LIndex <= 10000 do
+  begin
+    LSum := LSum + OpenArrayPeek(LValues, LIndex * 97);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 10000.0 * 1048576.0 * 8.0;
+  GSink := Trunc(LSum);
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_Sort_1M(var ABytesProcessed: Double);
+var
+  LValues: TIntegerArray;
+  LIndex: Integer;
+  LFound: Integer;
+  LHits: Integer;
+begin
+  SetLength(LValues, 1048576);
+  LIndex := 0;
+  while LIndex <= 1048575 do
+  begin
+    LValues[LIndex] := ((LIndex * 1103) mod 1000003) xor ((LIndex mod 4093) * 524269);
+    Inc(LIndex);
+  end;
+  TArray.Sort<Integer>(LValues);
+  LHits := 0;
+  LIndex := 1;
+  while LIndex <= 1000 do
+  begin
+    if TArray.BinarySearch<Integer>(LValues, LValues[LIndex * 1000], LFound) then
+      LHits := LHits + LFound;
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 1048576.0 * 4.0;
+  GSink := LHits;
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_Stats_1M(var ABytesProcessed: Double);
+var
+  LValues: TDoubleArray;
+  LIndex: Integer;
+  LTotal: Double;
+begin
+  SetLength(LValues, 1048576);
+  LIndex := 0;
+  while LIndex <= 1048575 do
+  begin
+    LValues[LIndex] := ((LIndex * 7919) mod 10007) * 0.001 + 1000.0;
+    Inc(LIndex);
+  end;
+  LTotal := Sum(LValues) + MinValue(LValues) + MaxValue(LValues);
+  LTotal := LTotal + Mean(LValues) + StdDev(LValues) + Norm(LValues);
+  ABytesProcessed := 1048576.0 * 8.0 * 7.0;
+  GSink := Trunc(LTotal);
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_SetScan_1M(var ABytesProcessed: Double);
+var
+  LText: string;
+  LIndex: Integer;
+  LIdent: Integer;
+begin
+  LText := DupeString('if (Count_1 >= 42) then Total := Total + $FF; { scan: x_2, y3  }', 16384);
+  LIdent := 0;
+  LIndex := 1;
+  while LIndex <= Length(LText) do
+  begin
+    if LText[LIndex] in ['A'..'Z', 'a'..'z', '0'..'9', '_'] then
+      Inc(LIdent);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 1048576.0 * 2.0;
+  GSink := LIdent;
+  if GSink = 0 then
+    Write('');
+end;
+
+procedure Bench_CheckedLoop_1M(var ABytesProcessed: Double);
+var
+  LValues: TIntegerArray;
+  LText: string;
+  LIndex: Integer;
+  LAcc: Integer;
+  LSum: Int64;
+begin
+  SetLength(LValues, 1048576);
+  LIndex := 0;
+  while LIndex <= 1048575 do
+  begin
+    LValues[LIndex] := ((LIndex mod 10007) * 7919) mod 10007;
+    Inc(LIndex);
+  end;
+  LText := DupeString('abcdefgh', 131072);
+  LAcc := 0;
+  LSum := 0;
+  LIndex := 0;
+  while LIndex < Length(LValues) do
+  begin
+    LAcc := (LAcc * 3 + LValues[LIndex]) mod 1000003;
+    LSum := LSum + LAcc;
+    if LText[LIndex + 1] = 'a' then
+      Inc(LSum);
+    Inc(LIndex);
+  end;
+  ABytesProcessed := 1048576.0 * 6.0;
+  GSink := LSum;
+  if GSink = 0 then
+    Write('');
+end;
+
 procedure RunBenchmark(const ABenchNum: Integer; var ABytesProcessed: Double);
 begin
   if ABenchNum = 1 then
@@ -356,7 +788,35 @@ begin
   else if ABenchNum = 2 then
     Bench_ArraySum_10M(ABytesProcessed)
   else if ABenchNum = 3 then
-    Bench_MatMul_64(ABytesProcessed);
+    Bench_MatMul_64(ABytesProcessed)
+  else if ABenchNum = 4 then
+    Bench_StringPass_100k(ABytesProcessed)
+  else if ABenchNum = 5 then
+    Bench_StringCompare_100k(ABytesProcessed)
+  else if ABenchNum = 6 then
+    Bench_StrUtils_10k(ABytesProcessed)
+  else if ABenchNum = 7 then
+    Bench_ConcatChain_10k(ABytesProcessed)
+  else if ABenchNum = 8 then
+    Bench_LogProcess_10k(ABytesProcessed)
+  else if ABenchNum = 9 then
+    Bench_CaseConvert_10k(ABytesProcessed)
+  else if ABenchNum = 10 then
+    Bench_ArrayPass_10k(ABytesProcessed)
+  else if ABenchNum = 11 then
+    Bench_ArraySlice_1k(ABytesProcessed)
+  else if ABenchNum = 12 then
+    Bench_GridBlur_512(ABytesProcessed)
+  else if ABenchNum = 13 then
+    Bench_OpenArray_1M(ABytesProcessed)
+  else if ABenchNum = 14 then
+    Bench_Sort_1M(ABytesProcessed)
+  else if ABenchNum = 15 then
+    Bench_Stats_1M(ABytesProcessed)
+  else if ABenchNum = 16 then
+    Bench_SetScan_1M(ABytesProcessed)
+  else if ABenchNum = 17 then
+    Bench_CheckedLoop_1M(ABytesProcessed);
 end;
 
 procedure WarmupBench(const ABenchNum: Integer; const ARounds: Integer);
@@ -480,6 +940,17 @@ begin
   {$ENDIF}
 end;
 
+procedure RunAndReport(const AVariantName: string; const ACsv: Boolean; const ABenchNum: Integer; const ABenchName: string; const ABytesHint: Double; const ATPS: Int64; const AWarmups: Integer; const ATargetMs: Integer);
+var
+  LResult: TBenchResult;
+begin
+  LResult := RunOne(ABenchNum, ABenchName, ABytesHint, ATPS, AWarmups, ATargetMs);
+  if ACsv then
+    PrintCsvRow(AVariantName, LResult)
+  else
+    PrintMarkdownRow(AVariantName, LResult);
+end;
+
 procedure RunBench();
 var
   LVariantName: string;
@@ -487,13 +958,6 @@ var
   LTargetMs: Integer;
   LCsv: Boolean;
   LTps: Int64;
-  LResult1: TBenchResult;
-  LResult2: TBenchResult;
-  LResult3: TBenchResult;
-  LBytes1: Double;
-  LBytes2: Double;
-  LBytes3: Double;
-
 
 begin
   GSink := 0;
@@ -517,34 +981,36 @@ begin
 
   LTps := TicksPerSec();
 
-  LBytes1 := 1024.0;
-  LBytes2 := 80000000.0;
-  LBytes3 := 98304.0;
-
   if LCsv then
-    PrintCsvHeader();
-
-  LResult1 := RunOne(1, 'string_concat_1k', LBytes1, LTps, LWarmups, LTargetMs);
-  LResult2 := RunOne(2, 'array_sum_10m', LBytes2, LTps, LWarmups, LTargetMs);
-  LResult3 := RunOne(3, 'matmul_64', LBytes3, LTps, LWarmups, LTargetMs);
-
-  if LCsv then
-  begin
-    PrintCsvRow(LVariantName, LResult1);
-    PrintCsvRow(LVariantName, LResult2);
-    PrintCsvRow(LVariantName, LResult3);
-  end
+    PrintCsvHeader()
   else
   begin
     WriteLn;
     WriteLn('| Variant | Benchmark | Iterations | ns/op | ops/s | MB/s |');
     WriteLn('|--------:|-----------|-----------:|------:|------:|-----:|');
-    PrintMarkdownRow(LVariantName, LResult1);
-    PrintMarkdownRow(LVariantName, LResult2);
-    PrintMarkdownRow(LVariantName, LResult3);
-    WriteLn;
   end;
 
+  RunAndReport(LVariantName, LCsv, 1, 'string_concat_1k', 1024.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 2, 'array_sum_10m', 80000000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 3, 'matmul_64', 98304.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 4, 'string_pass_100k', 51200000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 5, 'string_compare_100k', 88400000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 6, 'strutils_10k', 18680000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 7, 'concat_chain_10k', 993372.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 8, 'log_process_10k', 1656110.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 9, 'case_convert_10k', 9440000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 10, 'array_pass_10k', 1310720000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 11, 'array_slice_1k', 2621440000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 12, 'grid_blur_512', 6291456.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 13, 'open_array_1m', 83886080000.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 14, 'sort_1m', 4194304.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 15, 'stats_1m', 58720256.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 16, 'set_scan_1m', 2097152.0, LTps, LWarmups, LTargetMs);
+  RunAndReport(LVariantName, LCsv, 17, 'checked_loop_1m', 6291456.0, LTps, LWarmups, LTargetMs);
+
+  if not LCsv then
+    WriteLn;
+
   if GSink < 0 then
     WriteLn('Sink: ', IntToStr(GSink));
 end;
@@ -21,7 +21,7 @@
 
 #pragma once
 
-// Core types (Integer, Boolean, Single, Double, Extended, Char, String, Array, Set)
+// Core types (Integer, Boolean, Single, Double, Extended, Char, String, StringView, Array, Set)
 #include "runtime_types.h"
 
 // I/O functions (WriteLn, Write, TextFile)
@@ -30,6 +30,12 @@
 // String manipulation (Copy, Pos, UpperCase, LowerCase, etc.)
 #include "runtime_string.h"
 
+// StrUtils routines (ReverseString, DupeString, PadLeft, ContainsText, etc.)
+#include "runtime_strutils.h"
+
+// TArray.Sort and TArray.BinarySearch (pdqsort, radix and parallel sorts)
+#include "runtime_sort.h"
+
 // Math functions (Abs, Sqrt, Sin, Cos, etc.)
 #include "runtime_math.h"
 
@@ -472,7 +472,8 @@ template<typename T>
 inline auto ConvertFormatArg(T&& arg) {
     using DecayT = std::decay_t<T>;
     
-    if constexpr (std::is_same_v<DecayT, String>) {
+    if constexpr (std::is_same_v<DecayT, String> || std::is_same_v<DecayT, StringView> ||
+                  (internal::ConcatCount<DecayT>::value > 1)) {
         return arg.ToNarrow();
     } else if constexpr (std::is_same_v<DecayT, Integer>) {
         return arg.ToInt();
@@ -738,12 +739,8 @@ inline void Str(double value, int width, int decimals, String& result) {
 // ============================================================================
 
 inline void UniqueString(String& s) {
-    // C++ strings are already copy-on-write in most implementations
-    // or use move semantics. This is a no-op for modern C++ but
-    // provided for compatibility with Delphi semantics.
-    // Force a copy by creating temp and assigning back
-    String temp = s;
-    s = temp;
+    // Strings share their buffer on assignment; detach it like Delphi does
+    s.MakeUnique();
 }
 
 } // namespace bp
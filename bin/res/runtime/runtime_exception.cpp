@@ -11,10 +11,39 @@
 
 // runtime_exception.cpp - Implementation for runtime_exception.h
 // Most exception implementations are inline in the header
-// This file is for any non-inline implementations (currently empty)
+// This file holds the out-of-line raise paths of the overflow and range
+// checks, kept out of the inlined operators that call them
 
 #include "runtime_exception.h"
+#include <cstdio>
+#include <string>
 
 namespace bp {
-    // All implementations are inline in runtime_exception.h
+namespace internal {
+
+void RaiseOverflowError() {
+    String msg("Arithmetic overflow");
+    current_exception_message = msg;
+    throw EOverflow(msg);
+}
+
+void RaiseRangeError(long long index, long long low, long long high) {
+    std::string text = "Range check error: index " + std::to_string(index) +
+                       " outside " + std::to_string(low) + ".." + std::to_string(high);
+    String msg(text.c_str());
+    current_exception_message = msg;
+    throw ERangeError(msg);
 }
+
+void RaiseCharRangeError(unsigned ch) {
+    char code[8];
+    std::snprintf(code, sizeof(code), "%04X", ch);
+    std::string text = std::string("Range check error: character U+") + code +
+                       " does not fit in one UTF-8 code unit";
+    String msg(text.c_str());
+    current_exception_message = msg;
+    throw ERangeError(msg);
+}
+
+} // namespace internal
+} // namespace bp
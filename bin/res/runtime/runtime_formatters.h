@@ -78,6 +78,13 @@ struct std::formatter<bp::String> : std::formatter<std::string_view> {
     }
 };
 
+template<>
+struct std::formatter<bp::StringView> : std::formatter<std::string_view> {
+    auto format(const bp::StringView& value, std::format_context& ctx) const {
+        return std::formatter<std::string_view>::format(value.ToNarrow(), ctx);
+    }
+};
+
 // Pointer Type - format as void* address
 template<>
 struct std::formatter<bp::Pointer> : std::formatter<const void*> {
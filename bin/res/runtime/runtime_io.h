@@ -173,7 +173,7 @@ void Read(T& first, Args&... rest) {
 inline void ReadLn(String& s) {
     std::string temp;
     std::getline(std::cin, temp);
-    s = String(temp.c_str());
+    s = String::FromUTF8(temp);  // console input is UTF-8 (see InitializeConsole)
 }
 
 template<typename T>
@@ -202,7 +202,7 @@ public:
     void Reset() {
         try {
             file = std::make_unique<std::wfstream>();
-            file->open(filename.c_str_wide(), std::ios::in);
+            file->open(filename.NativePath(), std::ios::in);
             if (!file->is_open()) {
                 SetIOError(IOErrorCode::FileNotFound);
             } else {
@@ -217,7 +217,7 @@ public:
     void Rewrite() {
         try {
             file = std::make_unique<std::wfstream>();
-            file->open(filename.c_str_wide(), std::ios::out | std::ios::trunc);
+            file->open(filename.NativePath(), std::ios::out | std::ios::trunc);
             if (!file->is_open()) {
                 SetIOError(IOErrorCode::FileAccessDenied);
             } else {
@@ -232,7 +232,7 @@ public:
     void Append() {
         try {
             file = std::make_unique<std::wfstream>();
-            file->open(filename.c_str_wide(), std::ios::app);
+            file->open(filename.NativePath(), std::ios::app);
             if (!file->is_open()) {
                 SetIOError(IOErrorCode::FileAccessDenied);
             } else {
@@ -279,7 +279,7 @@ public:
         try {
             Close();
             std::error_code LError;
-            std::filesystem::remove(filename.c_str_wide(), LError);
+            std::filesystem::remove(filename.NativePath(), LError);
             SetIOError(MapSystemError(LError));
         } catch (const std::exception&) {
             SetIOError(IOErrorCode::IOError);
@@ -290,7 +290,7 @@ public:
         try {
             Close();
             std::error_code LError;
-            std::filesystem::rename(filename.c_str_wide(), newname.c_str_wide(), LError);
+            std::filesystem::rename(filename.NativePath(), newname.NativePath(), LError);
             if (!LError) {
                 filename = newname;
             }
@@ -516,11 +516,25 @@ public:
     
     // Specialized Write for bp::String - writes to wide stream
     void Write(const String& value) {
+        Write(StringView(value));
+    }
+    
+    // Specialized Write for string slices (Copy/Trim results)
+    void Write(const StringView& value) {
         try {
-            // Write the String to wide stream
-            for (int LI = 1; LI <= value.Length(); LI++) {
-                file->put(static_cast<wchar_t>(value[LI]));
+#if defined(BP_STRING_UTF8)
+            // UTF-8 storage: decode to the stream's wide characters
+            std::u16string LUnits(static_cast<std::size_t>(value.Length()), u'\0');
+            LUnits.resize(simd::DecodeUtf8(value.Data(), LUnits.size(), LUnits.data()));
+            for (char16_t LUnit : LUnits) {
+                file->put(static_cast<wchar_t>(LUnit));
+            }
+#else
+            const char16_t* LChars = value.Data();
+            for (int LI = 0; LI < value.Length(); LI++) {
+                file->put(static_cast<wchar_t>(LChars[LI]));
             }
+#endif
             if (file->fail()) {
                 SetIOError(IOErrorCode::IOError);
             } else {
@@ -531,6 +545,12 @@ public:
         }
     }
     
+    // Concatenations (A + B) are materialized once and written as a String
+    template<std::size_t N>
+    void Write(const StringConcat<N>& value) {
+        Write(String(value));
+    }
+    
     // Specialized Write for wide string literals
     void Write(const wchar_t* value) {
         try {
@@ -582,6 +602,17 @@ public:
         WriteLn();
     }
     
+    void WriteLn(const StringView& value) {
+        Write(value);
+        WriteLn();
+    }
+    
+    template<std::size_t N>
+    void WriteLn(const StringConcat<N>& value) {
+        Write(value);
+        WriteLn();
+    }
+    
     // Specialized WriteLn for wide string literals
     void WriteLn(const wchar_t* value) {
         // Use Write which preserves trailing spaces, then add newline
@@ -667,7 +698,7 @@ public:
     void Reset() {
         try {
             file = std::make_unique<std::fstream>();
-            file->open(filename.c_str_wide(), std::ios::in | std::ios::binary);
+            file->open(filename.NativePath(), std::ios::in | std::ios::binary);
             if (!file->is_open()) {
                 SetIOError(IOErrorCode::FileNotFound);
             } else {
@@ -686,7 +717,7 @@ public:
     void Rewrite() {
         try {
             file = std::make_unique<std::fstream>();
-            file->open(filename.c_str_wide(), std::ios::out | std::ios::binary);
+            file->open(filename.NativePath(), std::ios::out | std::ios::binary);
             if (!file->is_open()) {
                 SetIOError(IOErrorCode::FileAccessDenied);
             } else {
@@ -738,9 +769,9 @@ public:
             auto current_pos = file->tellp();
             file->close();
             std::error_code LError;
-            std::filesystem::resize_file(filename.c_str_wide(), static_cast<std::uintmax_t>(current_pos), LError);
+            std::filesystem::resize_file(filename.NativePath(), static_cast<std::uintmax_t>(current_pos), LError);
             if (!LError) {
-                file->open(filename.c_str_wide(), std::ios::in | std::ios::out | std::ios::binary);
+                file->open(filename.NativePath(), std::ios::in | std::ios::out | std::ios::binary);
                 file->seekp(current_pos);
             }
             SetIOError(MapSystemError(LError));
@@ -753,7 +784,7 @@ public:
         try {
             Close();
             std::error_code LError;
-            std::filesystem::remove(filename.c_str_wide(), LError);
+            std::filesystem::remove(filename.NativePath(), LError);
             SetIOError(MapSystemError(LError));
         } catch (const std::exception&) {
             SetIOError(IOErrorCode::IOError);
@@ -764,7 +795,7 @@ public:
         try {
             Close();
             std::error_code LError;
-            std::filesystem::rename(filename.c_str_wide(), newname.c_str_wide(), LError);
+            std::filesystem::rename(filename.NativePath(), newname.NativePath(), LError);
             if (!LError) {
                 filename = newname;
             }
@@ -1166,12 +1197,10 @@ inline bool Eof(const BinaryFile& f) {
 
 inline Boolean FileExists(const String& filename) {
     try {
+        // One stat call: a missing path or an error yields a non-regular status
         std::error_code LError;
-        bool LExists = std::filesystem::exists(filename.c_str_wide(), LError);
-        if (LError) {
-            return Boolean(false);
-        }
-        return Boolean(LExists && std::filesystem::is_regular_file(filename.c_str_wide(), LError));
+        std::filesystem::file_status LStatus = std::filesystem::status(filename.NativePath(), LError);
+        return Boolean(!LError && std::filesystem::is_regular_file(LStatus));
     } catch (const std::exception&) {
         return Boolean(false);
     }
@@ -1180,7 +1209,7 @@ inline Boolean FileExists(const String& filename) {
 inline Boolean RemoveFile(const String& filename) {
     try {
         std::error_code LError;
-        bool LResult = std::filesystem::remove(filename.c_str_wide(), LError);
+        bool LResult = std::filesystem::remove(filename.NativePath(), LError);
         if (LError) {
             SetIOError(MapSystemError(LError));
             return Boolean(false);
@@ -1196,7 +1225,7 @@ inline Boolean RemoveFile(const String& filename) {
 inline Boolean RenameFile(const String& oldname, const String& newname) {
     try {
         std::error_code LError;
-        std::filesystem::rename(oldname.c_str_wide(), newname.c_str_wide(), LError);
+        std::filesystem::rename(oldname.NativePath(), newname.NativePath(), LError);
         if (LError) {
             SetIOError(MapSystemError(LError));
             return Boolean(false);
@@ -1211,12 +1240,10 @@ inline Boolean RenameFile(const String& oldname, const String& newname) {
 
 inline Boolean DirectoryExists(const String& dirname) {
     try {
+        // One stat call: a missing path or an error yields a non-directory status
         std::error_code LError;
-        bool LExists = std::filesystem::exists(dirname.c_str_wide(), LError);
-        if (LError) {
-            return Boolean(false);
-        }
-        return Boolean(LExists && std::filesystem::is_directory(dirname.c_str_wide(), LError));
+        std::filesystem::file_status LStatus = std::filesystem::status(dirname.NativePath(), LError);
+        return Boolean(!LError && std::filesystem::is_directory(LStatus));
     } catch (const std::exception&) {
         return Boolean(false);
     }
@@ -1225,7 +1252,7 @@ inline Boolean DirectoryExists(const String& dirname) {
 inline Boolean CreateDir(const String& dirname) {
     try {
         std::error_code LError;
-        bool LResult = std::filesystem::create_directory(dirname.c_str_wide(), LError);
+        bool LResult = std::filesystem::create_directory(dirname.NativePath(), LError);
         if (LError) {
             SetIOError(MapSystemError(LError));
             return Boolean(false);
@@ -1241,7 +1268,7 @@ inline Boolean CreateDir(const String& dirname) {
 inline Boolean RemoveDir(const String& dirname) {
     try {
         std::error_code LError;
-        bool LResult = std::filesystem::remove(dirname.c_str_wide(), LError);
+        bool LResult = std::filesystem::remove(dirname.NativePath(), LError);
         if (LError) {
             SetIOError(MapSystemError(LError));
             return Boolean(false);
@@ -1273,7 +1300,7 @@ inline String GetCurrentDir() {
 inline Boolean SetCurrentDir(const String& dirname) {
     try {
         std::error_code LError;
-        std::filesystem::current_path(dirname.c_str_wide(), LError);
+        std::filesystem::current_path(dirname.NativePath(), LError);
         if (LError) {
             SetIOError(MapSystemError(LError));
             return Boolean(false);
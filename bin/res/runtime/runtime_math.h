@@ -17,6 +17,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
+#include <limits>
 
 namespace bp {
 
@@ -612,4 +613,296 @@ inline Extended LogN(const Extended& base, const Extended& value) {
     return Extended(std::logl(value.ToLongDouble()) / std::logl(base.ToLongDouble()));
 }
 
+// ============================================================================
+// Array Statistics - Sum, SumInt, SumOfSquares, MinValue, MaxValue,
+// MinIntValue, MaxIntValue, Mean, Variance, StdDev, MeanAndStdDev, Norm
+// As in Delphi's Math unit, over Double, Single, Integer or Int64 elements.
+// Each takes a dynamic array, static array, open array or matrix row, or a
+// pointer and an element count. The loops are the vector kernels in
+// runtime_simd.h; floating-point totals are compensated, so Sum and Mean
+// keep full precision on long arrays. Single arrays are summed in double
+// ============================================================================
+
+namespace internal {
+
+// Raw element type, floating-point result type and Sum result type.
+// Integer arrays sum exactly into an Int64
+template<typename T> struct Reduce;
+
+template<> struct Reduce<Double> {
+    using Raw = double;
+    using Real = Double;
+    using RealRaw = double;
+    using Total = Double;
+};
+
+template<> struct Reduce<Single> {
+    using Raw = float;
+    using Real = Single;
+    using RealRaw = float;
+    using Total = Single;
+};
+
+template<> struct Reduce<Integer> {
+    using Raw = int;
+    using Real = Double;
+    using RealRaw = double;
+    using Total = Int64;
+};
+
+template<> struct Reduce<Int64> {
+    using Raw = long long;
+    using Real = Double;
+    using RealRaw = double;
+    using Total = Int64;
+};
+
+template<typename T>
+concept Reducible = requires { typename Reduce<T>::Raw; };
+
+// The wrappers hold exactly one scalar, so an array of them is an array of it
+template<Reducible T>
+inline const typename Reduce<T>::Raw* RawElements(const T* data) {
+    static_assert(sizeof(T) == sizeof(typename Reduce<T>::Raw) && std::is_standard_layout_v<T>);
+    return reinterpret_cast<const typename Reduce<T>::Raw*>(data);
+}
+
+inline std::size_t ReduceCount(const Integer& count) {
+    return count.ToInt() > 0 ? static_cast<std::size_t>(count.ToInt()) : 0;
+}
+
+template<Reducible T>
+inline typename Reduce<T>::Real ToReal(double v) {
+    return typename Reduce<T>::Real(static_cast<typename Reduce<T>::RealRaw>(v));
+}
+
+template<typename T>
+inline OpenArray<const T> ReduceElements(const Array<T>& a) { return a; }
+
+template<typename T, std::size_t N>
+inline OpenArray<const T> ReduceElements(const StaticArray<T, N>& a) { return a; }
+
+template<typename T>
+inline OpenArray<const T> ReduceElements(OpenArray<T> a) { return a; }
+
+template<typename T>
+inline OpenArray<const T> ReduceElements(MatrixRow<T> row) { return row; }
+
+template<typename A>
+using ReduceElement = std::remove_cvref_t<decltype(*ReduceElements(std::declval<const A&>()).Data())>;
+
+template<typename A>
+concept ReducibleArray = requires(const A& a) { ReduceElements(a); } && Reducible<ReduceElement<A>>;
+
+// Sqrt of the sum of squares. If the squares overflow or underflow, the
+// elements are scaled by the largest magnitude first
+inline double Norm(const double* p, std::size_t n) {
+    double squares = simd::SumAsDouble<true>(p, n);
+    if (squares >= std::numeric_limits<double>::min() && squares <= std::numeric_limits<double>::max()) {
+        return std::sqrt(squares);
+    }
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; i++) scale = std::max(scale, std::fabs(p[i]));
+    if (scale == 0.0 || !std::isfinite(scale)) return std::sqrt(squares);
+    simd::CompensatedSum total;
+    for (std::size_t i = 0; i < n; i++) {
+        double x = p[i] / scale;
+        total.Add(x * x);
+    }
+    return scale * std::sqrt(total.Total());
+}
+
+template<typename Raw>
+inline double Norm(const Raw* p, std::size_t n) {
+    return std::sqrt(simd::SumAsDouble<true>(p, n));
+}
+
+// Integer means divide the exact total; the rest use the compensated sum
+template<typename Raw>
+inline double MeanOf(const Raw* p, std::size_t n) {
+    if constexpr (std::is_same_v<Raw, int>) {
+        return static_cast<double>(simd::SumIntegers(p, n)) / static_cast<double>(n);
+    } else {
+        return simd::SumAsDouble<false>(p, n) / static_cast<double>(n);
+    }
+}
+
+// Sample variance (divided by n - 1, as Delphi's Variance), 0 for n < 2.
+// The deviations from the mean sum to zero in exact arithmetic; subtracting
+// what they do sum to corrects for the rounding of the mean (the corrected
+// two-pass algorithm)
+template<typename Raw>
+inline double SampleVariance(const Raw* p, std::size_t n, double mean) {
+    if (n < 2) return 0.0;
+    double sum;
+    double squares;
+    simd::SumDeviations(p, n, mean, sum, squares);
+    squares -= sum * sum / static_cast<double>(n);
+    return squares > 0.0 ? squares / static_cast<double>(n - 1) : 0.0;
+}
+
+} // namespace internal
+
+// Total of the elements: Double for Double arrays, Single for Single
+// arrays and Int64 (exact) for Integer and Int64 arrays
+template<internal::Reducible T>
+inline typename internal::Reduce<T>::Total Sum(const T* data, const Integer& count) {
+    const auto* p = internal::RawElements(data);
+    std::size_t n = internal::ReduceCount(count);
+    if constexpr (std::is_integral_v<typename internal::Reduce<T>::Raw>) {
+        return Int64(simd::SumIntegers(p, n));
+    } else {
+        return internal::ToReal<T>(simd::SumAsDouble<false>(p, n));
+    }
+}
+
+// Delphi's SumInt: the total of an Integer array, wrapping as Integer does
+inline Integer SumInt(const Integer* data, const Integer& count) {
+    return Integer(static_cast<int>(static_cast<unsigned int>(
+        simd::SumIntegers(internal::RawElements(data), internal::ReduceCount(count)))));
+}
+
+template<internal::Reducible T>
+inline typename internal::Reduce<T>::Real SumOfSquares(const T* data, const Integer& count) {
+    return internal::ToReal<T>(simd::SumAsDouble<true>(internal::RawElements(data), internal::ReduceCount(count)));
+}
+
+// MinValue/MaxValue of an empty array return 0
+template<internal::Reducible T>
+inline T MinValue(const T* data, const Integer& count) {
+    std::size_t n = internal::ReduceCount(count);
+    return n ? T(simd::Extreme<false>(internal::RawElements(data), n)) : T();
+}
+
+template<internal::Reducible T>
+inline T MaxValue(const T* data, const Integer& count) {
+    std::size_t n = internal::ReduceCount(count);
+    return n ? T(simd::Extreme<true>(internal::RawElements(data), n)) : T();
+}
+
+inline Integer MinIntValue(const Integer* data, const Integer& count) {
+    return MinValue(data, count);
+}
+
+inline Integer MaxIntValue(const Integer* data, const Integer& count) {
+    return MaxValue(data, count);
+}
+
+// Mean of an empty array is NaN (0 / 0)
+template<internal::Reducible T>
+inline typename internal::Reduce<T>::Real Mean(const T* data, const Integer& count) {
+    std::size_t n = internal::ReduceCount(count);
+    if (n == 0) return internal::ToReal<T>(std::numeric_limits<double>::quiet_NaN());
+    return internal::ToReal<T>(internal::MeanOf(internal::RawElements(data), n));
+}
+
+template<internal::Reducible T>
+inline typename internal::Reduce<T>::Real Variance(const T* data, const Integer& count) {
+    std::size_t n = internal::ReduceCount(count);
+    if (n < 2) return internal::ToReal<T>(0.0);
+    const auto* p = internal::RawElements(data);
+    return internal::ToReal<T>(internal::SampleVariance(p, n, internal::MeanOf(p, n)));
+}
+
+template<internal::Reducible T>
+inline typename internal::Reduce<T>::Real StdDev(const T* data, const Integer& count) {
+    std::size_t n = internal::ReduceCount(count);
+    if (n < 2) return internal::ToReal<T>(0.0);
+    const auto* p = internal::RawElements(data);
+    return internal::ToReal<T>(std::sqrt(internal::SampleVariance(p, n, internal::MeanOf(p, n))));
+}
+
+// Mean and sample standard deviation in two passes over the data
+template<internal::Reducible T>
+inline void MeanAndStdDev(const T* data, const Integer& count,
+                          typename internal::Reduce<T>::Real& mean,
+                          typename internal::Reduce<T>::Real& stdDev) {
+    std::size_t n = internal::ReduceCount(count);
+    if (n == 0) {
+        mean = internal::ToReal<T>(std::numeric_limits<double>::quiet_NaN());
+        stdDev = internal::ToReal<T>(0.0);
+        return;
+    }
+    const auto* p = internal::RawElements(data);
+    double m = internal::MeanOf(p, n);
+    mean = internal::ToReal<T>(m);
+    stdDev = internal::ToReal<T>(std::sqrt(internal::SampleVariance(p, n, m)));
+}
+
+// Euclidean length: Sqrt(SumOfSquares)
+template<internal::Reducible T>
+inline typename internal::Reduce<T>::Real Norm(const T* data, const Integer& count) {
+    return internal::ToReal<T>(internal::Norm(internal::RawElements(data), internal::ReduceCount(count)));
+}
+
+// Array forms: dynamic arrays, static arrays, open arrays and matrix rows
+
+template<internal::ReducibleArray A>
+inline auto Sum(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return Sum(v.Data(), v.Length());
+}
+
+inline Integer SumInt(const OpenArray<const Integer>& data) {
+    return SumInt(data.Data(), data.Length());
+}
+
+template<internal::ReducibleArray A>
+inline auto SumOfSquares(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return SumOfSquares(v.Data(), v.Length());
+}
+
+template<internal::ReducibleArray A>
+inline auto MinValue(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return MinValue(v.Data(), v.Length());
+}
+
+template<internal::ReducibleArray A>
+inline auto MaxValue(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return MaxValue(v.Data(), v.Length());
+}
+
+inline Integer MinIntValue(const OpenArray<const Integer>& data) {
+    return MinValue(data.Data(), data.Length());
+}
+
+inline Integer MaxIntValue(const OpenArray<const Integer>& data) {
+    return MaxValue(data.Data(), data.Length());
+}
+
+template<internal::ReducibleArray A>
+inline auto Mean(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return Mean(v.Data(), v.Length());
+}
+
+template<internal::ReducibleArray A>
+inline auto Variance(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return Variance(v.Data(), v.Length());
+}
+
+template<internal::ReducibleArray A>
+inline auto StdDev(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return StdDev(v.Data(), v.Length());
+}
+
+template<internal::ReducibleArray A>
+inline void MeanAndStdDev(const A& data,
+                          typename internal::Reduce<internal::ReduceElement<A>>::Real& mean,
+                          typename internal::Reduce<internal::ReduceElement<A>>::Real& stdDev) {
+    auto v = internal::ReduceElements(data);
+    MeanAndStdDev(v.Data(), v.Length(), mean, stdDev);
+}
+
+template<internal::ReducibleArray A>
+inline auto Norm(const A& data) {
+    auto v = internal::ReduceElements(data);
+    return Norm(v.Data(), v.Length());
+}
+
 } // namespace bp
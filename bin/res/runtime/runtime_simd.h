@@ -0,0 +1,1536 @@
+/*******************************************************************************
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+*******************************************************************************/
+
+// runtime_simd.h - Vectorized kernels used by the runtime (UTF-16/UTF-8 strings, transcoding, hashing,
+// numeric reductions)
+// SSE2/AVX2 paths are selected at compile time; every kernel has a scalar
+// fallback so the runtime still builds for targets without x86 SIMD
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__)
+    #define BP_SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BP_SIMD_SSE2 1
+#endif
+
+#if defined(BP_SIMD_AVX2)
+    #include <immintrin.h>
+#elif defined(BP_SIMD_SSE2)
+    #include <emmintrin.h>
+#endif
+
+namespace bp {
+namespace simd {
+
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+// ============================================================================
+// Scalar Helpers
+// ============================================================================
+
+// ASCII-only case fold ('a'..'z' -> 'A'..'Z'), matching SameText/UpperCase
+inline constexpr char16_t FoldAscii(char16_t c) {
+    return (c >= u'a' && c <= u'z') ? static_cast<char16_t>(c - (u'a' - u'A')) : c;
+}
+
+#if defined(BP_SIMD_SSE2)
+// Uppercase the 'a'..'z' lanes of 8 UTF-16 code units. Signed compares are
+// safe here: code units >= 0x8000 become negative and fall outside the range
+inline __m128i FoldAscii8(__m128i v) {
+    const __m128i lo = _mm_set1_epi16(u'a' - 1);
+    const __m128i hi = _mm_set1_epi16(u'z' + 1);
+    const __m128i isLower = _mm_and_si128(_mm_cmpgt_epi16(v, lo), _mm_cmplt_epi16(v, hi));
+    return _mm_sub_epi16(v, _mm_and_si128(isLower, _mm_set1_epi16(u'a' - u'A')));
+}
+#endif
+
+#if defined(BP_SIMD_AVX2)
+inline __m256i FoldAscii16(__m256i v) {
+    const __m256i lo = _mm256_set1_epi16(u'a' - 1);
+    const __m256i hi = _mm256_set1_epi16(u'z' + 1);
+    const __m256i isLower = _mm256_and_si256(_mm256_cmpgt_epi16(v, lo), _mm256_cmpgt_epi16(hi, v));
+    return _mm256_sub_epi16(v, _mm256_and_si256(isLower, _mm256_set1_epi16(u'a' - u'A')));
+}
+#endif
+
+// ============================================================================
+// Comparison Kernels
+// ============================================================================
+
+// Index of the first code unit where a and b differ, or n if they are equal
+inline std::size_t Mismatch(const char16_t* a, const char16_t* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 16 <= n; i += 16) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(va, vb)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + std::countr_zero(~mask) / 2;
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    for (; i + 8 <= n; i += 8) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(va, vb)));
+        if (mask != 0xFFFFu) {
+            return i + std::countr_zero(~mask) / 2;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != b[i]) return i;
+    }
+    return n;
+}
+
+// Same as Mismatch, but 'a'..'z' compare equal to 'A'..'Z'
+inline std::size_t MismatchIgnoreAsciiCase(const char16_t* a, const char16_t* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 16 <= n; i += 16) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(FoldAscii16(va), FoldAscii16(vb))));
+        if (mask != 0xFFFFFFFFu) {
+            return i + std::countr_zero(~mask) / 2;
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    for (; i + 8 <= n; i += 8) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(FoldAscii8(va), FoldAscii8(vb))));
+        if (mask != 0xFFFFu) {
+            return i + std::countr_zero(~mask) / 2;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (FoldAscii(a[i]) != FoldAscii(b[i])) return i;
+    }
+    return n;
+}
+
+// Three-way ordinal comparison by code unit value: -1, 0 or 1
+inline int Compare(const char16_t* a, std::size_t lenA, const char16_t* b, std::size_t lenB) {
+    std::size_t n = lenA < lenB ? lenA : lenB;
+    std::size_t i = Mismatch(a, b, n);
+    if (i < n) return a[i] < b[i] ? -1 : 1;
+    if (lenA == lenB) return 0;
+    return lenA < lenB ? -1 : 1;
+}
+
+// Whether a[0..n) equals the 32-bit units b[0..n) (wchar_t text where wchar_t
+// is UTF-32); units above 0xFFFF never match
+inline bool EqualsWide32(const char16_t* a, const std::uint32_t* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i lo = _mm_cmpeq_epi32(_mm_unpacklo_epi16(va, zero), _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        __m128i hi = _mm_cmpeq_epi32(_mm_unpackhi_epi16(va, zero), _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 4)));
+        if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF) {
+            return false;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// Whether a[0..n) equals the Latin-1 text b[0..n)
+inline bool EqualsLatin1(const char16_t* a, const char* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i lo = _mm_cmpeq_epi16(_mm_unpacklo_epi8(vb, zero), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+        __m128i hi = _mm_cmpeq_epi16(_mm_unpackhi_epi8(vb, zero), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 8)));
+        if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF) {
+            return false;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != static_cast<unsigned char>(b[i])) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Byte Comparison Kernels
+// The same operations on UTF-8 code units, used when BP_STRING_UTF8 stores
+// strings as UTF-8. Ordering compares bytes unsigned, which is code point order
+// ============================================================================
+
+inline constexpr char FoldAscii(char c) {
+    return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+}
+
+#if defined(BP_SIMD_SSE2)
+// Uppercase the 'a'..'z' lanes of 16 bytes (bytes >= 0x80 compare negative)
+inline __m128i FoldAsciiBytes16(__m128i v) {
+    const __m128i lo = _mm_set1_epi8('a' - 1);
+    const __m128i hi = _mm_set1_epi8('z' + 1);
+    const __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+    return _mm_sub_epi8(v, _mm_and_si128(isLower, _mm_set1_epi8('a' - 'A')));
+}
+#endif
+
+#if defined(BP_SIMD_AVX2)
+inline __m256i FoldAsciiBytes32(__m256i v) {
+    const __m256i lo = _mm256_set1_epi8('a' - 1);
+    const __m256i hi = _mm256_set1_epi8('z' + 1);
+    const __m256i isLower = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+    return _mm256_sub_epi8(v, _mm256_and_si256(isLower, _mm256_set1_epi8('a' - 'A')));
+}
+#endif
+
+inline std::size_t Mismatch(const char* a, const char* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+        if (mask != 0xFFFFFFFFu) {
+            return i + std::countr_zero(~mask);
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)));
+        if (mask != 0xFFFFu) {
+            return i + std::countr_zero(~mask);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != b[i]) return i;
+    }
+    return n;
+}
+
+inline std::size_t MismatchIgnoreAsciiCase(const char* a, const char* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 32 <= n; i += 32) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(FoldAsciiBytes32(va), FoldAsciiBytes32(vb))));
+        if (mask != 0xFFFFFFFFu) {
+            return i + std::countr_zero(~mask);
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(FoldAsciiBytes16(va), FoldAsciiBytes16(vb))));
+        if (mask != 0xFFFFu) {
+            return i + std::countr_zero(~mask);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (FoldAscii(a[i]) != FoldAscii(b[i])) return i;
+    }
+    return n;
+}
+
+inline int Compare(const char* a, std::size_t lenA, const char* b, std::size_t lenB) {
+    std::size_t n = lenA < lenB ? lenA : lenB;
+    std::size_t i = Mismatch(a, b, n);
+    if (i < n) return static_cast<unsigned char>(a[i]) < static_cast<unsigned char>(b[i]) ? -1 : 1;
+    if (lenA == lenB) return 0;
+    return lenA < lenB ? -1 : 1;
+}
+
+// Whether the 32-bit units a[0..n) equal the bytes b[0..n) (ASCII wchar_t
+// literals against UTF-8 text where wchar_t is UTF-32)
+inline bool EqualsLatin1(const std::uint32_t* a, const char* b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i vb = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(b + i)), zero);
+        __m128i lo = _mm_cmpeq_epi32(_mm_unpacklo_epi16(vb, zero), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+        __m128i hi = _mm_cmpeq_epi32(_mm_unpackhi_epi16(vb, zero), _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 4)));
+        if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF) {
+            return false;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != static_cast<unsigned char>(b[i])) return false;
+    }
+    return true;
+}
+
+
+// ============================================================================
+// Search Kernels
+// ============================================================================
+
+// Index of the first occurrence of needle in hay, or npos. The vector loop
+// tests the first and last needle code unit at 8/16 positions at once and
+// only runs a full compare on positions where both match
+inline std::size_t Find(const char16_t* hay, std::size_t n, const char16_t* needle, std::size_t m) {
+    if (m == 0) return 0;
+    if (m > n) return npos;
+
+    const std::size_t last = m - 1;
+    const std::size_t tailBytes = last * sizeof(char16_t);
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    {
+        const __m256i first = _mm256_set1_epi16(static_cast<short>(needle[0]));
+        const __m256i tail = _mm256_set1_epi16(static_cast<short>(needle[last]));
+        for (; i + last + 16 <= n; i += 16) {
+            __m256i bf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i));
+            __m256i bl = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i + last));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi16(bf, first), _mm256_cmpeq_epi16(bl, tail))));
+            while (mask != 0) {
+                unsigned bit = std::countr_zero(mask);
+                std::size_t pos = i + bit / 2;
+                if (std::memcmp(hay + pos + 1, needle + 1, tailBytes) == 0) return pos;
+                mask &= ~(3u << bit);
+            }
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    {
+        const __m128i first = _mm_set1_epi16(static_cast<short>(needle[0]));
+        const __m128i tail = _mm_set1_epi16(static_cast<short>(needle[last]));
+        for (; i + last + 8 <= n; i += 8) {
+            __m128i bf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i));
+            __m128i bl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + last));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi16(bf, first), _mm_cmpeq_epi16(bl, tail))));
+            while (mask != 0) {
+                unsigned bit = std::countr_zero(mask);
+                std::size_t pos = i + bit / 2;
+                if (std::memcmp(hay + pos + 1, needle + 1, tailBytes) == 0) return pos;
+                mask &= ~(3u << bit);
+            }
+        }
+    }
+#endif
+    for (; i + last < n; i++) {
+        if (hay[i] == needle[0] && hay[i + last] == needle[last] &&
+            std::memcmp(hay + i + 1, needle + 1, tailBytes) == 0) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+// Find with 'a'..'z' matching 'A'..'Z' (same folding as SameText). The
+// filter folds each block of hay before testing it against the folded first
+// and last needle units, so neither string is copied
+inline std::size_t FindIgnoreAsciiCase(const char16_t* hay, std::size_t n, const char16_t* needle, std::size_t m) {
+    if (m == 0) return 0;
+    if (m > n) return npos;
+
+    const std::size_t last = m - 1;
+    const char16_t firstUnit = FoldAscii(needle[0]);
+    const char16_t lastUnit = FoldAscii(needle[last]);
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    {
+        const __m256i first = _mm256_set1_epi16(static_cast<short>(firstUnit));
+        const __m256i tail = _mm256_set1_epi16(static_cast<short>(lastUnit));
+        for (; i + last + 16 <= n; i += 16) {
+            __m256i bf = FoldAscii16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i)));
+            __m256i bl = FoldAscii16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i + last)));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi16(bf, first), _mm256_cmpeq_epi16(bl, tail))));
+            while (mask != 0) {
+                unsigned bit = std::countr_zero(mask);
+                std::size_t pos = i + bit / 2;
+                if (MismatchIgnoreAsciiCase(hay + pos + 1, needle + 1, last) == last) return pos;
+                mask &= ~(3u << bit);
+            }
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    {
+        const __m128i first = _mm_set1_epi16(static_cast<short>(firstUnit));
+        const __m128i tail = _mm_set1_epi16(static_cast<short>(lastUnit));
+        for (; i + last + 8 <= n; i += 8) {
+            __m128i bf = FoldAscii8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i)));
+            __m128i bl = FoldAscii8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + last)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi16(bf, first), _mm_cmpeq_epi16(bl, tail))));
+            while (mask != 0) {
+                unsigned bit = std::countr_zero(mask);
+                std::size_t pos = i + bit / 2;
+                if (MismatchIgnoreAsciiCase(hay + pos + 1, needle + 1, last) == last) return pos;
+                mask &= ~(3u << bit);
+            }
+        }
+    }
+#endif
+    for (; i + last < n; i++) {
+        if (FoldAscii(hay[i]) == firstUnit && FoldAscii(hay[i + last]) == lastUnit &&
+            MismatchIgnoreAsciiCase(hay + i + 1, needle + 1, last) == last) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+// Byte forms of Find and FindIgnoreAsciiCase (UTF-8 strings). A match at a
+// byte position is a match of whole characters, since UTF-8 is self-synchronizing
+inline std::size_t Find(const char* hay, std::size_t n, const char* needle, std::size_t m) {
+    if (m == 0) return 0;
+    if (m > n) return npos;
+
+    const std::size_t last = m - 1;
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    {
+        const __m256i first = _mm256_set1_epi8(needle[0]);
+        const __m256i tail = _mm256_set1_epi8(needle[last]);
+        for (; i + last + 32 <= n; i += 32) {
+            __m256i bf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i));
+            __m256i bl = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i + last));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(bf, first), _mm256_cmpeq_epi8(bl, tail))));
+            while (mask != 0) {
+                std::size_t pos = i + std::countr_zero(mask);
+                if (std::memcmp(hay + pos + 1, needle + 1, last) == 0) return pos;
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    {
+        const __m128i first = _mm_set1_epi8(needle[0]);
+        const __m128i tail = _mm_set1_epi8(needle[last]);
+        for (; i + last + 16 <= n; i += 16) {
+            __m128i bf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i));
+            __m128i bl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + last));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(bf, first), _mm_cmpeq_epi8(bl, tail))));
+            while (mask != 0) {
+                std::size_t pos = i + std::countr_zero(mask);
+                if (std::memcmp(hay + pos + 1, needle + 1, last) == 0) return pos;
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+    for (; i + last < n; i++) {
+        if (hay[i] == needle[0] && hay[i + last] == needle[last] &&
+            std::memcmp(hay + i + 1, needle + 1, last) == 0) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+inline std::size_t FindIgnoreAsciiCase(const char* hay, std::size_t n, const char* needle, std::size_t m) {
+    if (m == 0) return 0;
+    if (m > n) return npos;
+
+    const std::size_t last = m - 1;
+    const char firstUnit = FoldAscii(needle[0]);
+    const char lastUnit = FoldAscii(needle[last]);
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    {
+        const __m256i first = _mm256_set1_epi8(firstUnit);
+        const __m256i tail = _mm256_set1_epi8(lastUnit);
+        for (; i + last + 32 <= n; i += 32) {
+            __m256i bf = FoldAsciiBytes32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i)));
+            __m256i bl = FoldAsciiBytes32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hay + i + last)));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(bf, first), _mm256_cmpeq_epi8(bl, tail))));
+            while (mask != 0) {
+                std::size_t pos = i + std::countr_zero(mask);
+                if (MismatchIgnoreAsciiCase(hay + pos + 1, needle + 1, last) == last) return pos;
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    {
+        const __m128i first = _mm_set1_epi8(firstUnit);
+        const __m128i tail = _mm_set1_epi8(lastUnit);
+        for (; i + last + 16 <= n; i += 16) {
+            __m128i bf = FoldAsciiBytes16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i)));
+            __m128i bl = FoldAsciiBytes16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + last)));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(bf, first), _mm_cmpeq_epi8(bl, tail))));
+            while (mask != 0) {
+                std::size_t pos = i + std::countr_zero(mask);
+                if (MismatchIgnoreAsciiCase(hay + pos + 1, needle + 1, last) == last) return pos;
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+    for (; i + last < n; i++) {
+        if (FoldAscii(hay[i]) == firstUnit && FoldAscii(hay[i + last]) == lastUnit &&
+            MismatchIgnoreAsciiCase(hay + i + 1, needle + 1, last) == last) {
+            return i;
+        }
+    }
+    return npos;
+}
+
+
+// ============================================================================
+// Copy Kernels
+// ============================================================================
+
+// dst[i] = src[n - 1 - i] (dst and src must not overlap). SSE2 has no 16-bit
+// lane permute, so each block reverses its dwords, then the words in each dword
+inline void Reverse(const char16_t* src, std::size_t n, char16_t* dst) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n - i - 8));
+        v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = src[n - 1 - i];
+    }
+}
+
+// Byte reversal (UTF-8 strings; like ReverseString it reverses code units)
+inline void Reverse(const char* src, std::size_t n, char* dst) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n - i - 16));
+        // Swap the bytes of each word, then reverse the words as above
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = src[n - 1 - i];
+    }
+}
+
+// ============================================================================
+// Case Mapping Kernels
+// ChangeAsciiCase maps 'a'..'z' / 'A'..'Z' only (UpperCase/LowerCase). The
+// Unicode forms take a per-unit mapping and use it only for blocks that
+// contain non-ASCII units; all-ASCII blocks stay on the vector path
+// ============================================================================
+
+template<bool Upper, typename CharT>
+inline constexpr CharT ChangeAsciiCase(CharT c) {
+    if constexpr (Upper) {
+        return (c >= 'a' && c <= 'z') ? static_cast<CharT>(c - ('a' - 'A')) : c;
+    } else {
+        return (c >= 'A' && c <= 'Z') ? static_cast<CharT>(c + ('a' - 'A')) : c;
+    }
+}
+
+#if defined(BP_SIMD_SSE2)
+// Same signed-compare trick as FoldAscii8: units >= 0x8000 (or bytes >= 0x80)
+// are negative and never fall inside the letter range
+template<bool Upper>
+inline __m128i ChangeAsciiCase8(__m128i v) {
+    const __m128i lo = _mm_set1_epi16(Upper ? u'a' - 1 : u'A' - 1);
+    const __m128i hi = _mm_set1_epi16(Upper ? u'z' + 1 : u'Z' + 1);
+    const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi16(v, lo), _mm_cmplt_epi16(v, hi));
+    return _mm_xor_si128(v, _mm_and_si128(inRange, _mm_set1_epi16(0x20)));
+}
+
+template<bool Upper>
+inline __m128i ChangeAsciiCaseBytes16(__m128i v) {
+    const __m128i lo = _mm_set1_epi8(Upper ? 'a' - 1 : 'A' - 1);
+    const __m128i hi = _mm_set1_epi8(Upper ? 'z' + 1 : 'Z' + 1);
+    const __m128i inRange = _mm_and_si128(_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi));
+    return _mm_xor_si128(v, _mm_and_si128(inRange, _mm_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(BP_SIMD_AVX2)
+template<bool Upper>
+inline __m256i ChangeAsciiCase16(__m256i v) {
+    const __m256i lo = _mm256_set1_epi16(Upper ? u'a' - 1 : u'A' - 1);
+    const __m256i hi = _mm256_set1_epi16(Upper ? u'z' + 1 : u'Z' + 1);
+    const __m256i inRange = _mm256_and_si256(_mm256_cmpgt_epi16(v, lo), _mm256_cmpgt_epi16(hi, v));
+    return _mm256_xor_si256(v, _mm256_and_si256(inRange, _mm256_set1_epi16(0x20)));
+}
+
+template<bool Upper>
+inline __m256i ChangeAsciiCaseBytes32(__m256i v) {
+    const __m256i lo = _mm256_set1_epi8(Upper ? 'a' - 1 : 'A' - 1);
+    const __m256i hi = _mm256_set1_epi8(Upper ? 'z' + 1 : 'Z' + 1);
+    const __m256i inRange = _mm256_and_si256(_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v));
+    return _mm256_xor_si256(v, _mm256_and_si256(inRange, _mm256_set1_epi8(0x20)));
+}
+#endif
+
+// dst[i] = src[i] with ASCII letters mapped; every other unit is copied
+template<bool Upper>
+inline void ChangeAsciiCase(const char16_t* src, std::size_t n, char16_t* dst) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 16 <= n; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), ChangeAsciiCase16<Upper>(v));
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), ChangeAsciiCase8<Upper>(v));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = ChangeAsciiCase<Upper>(src[i]);
+    }
+}
+
+template<bool Upper>
+inline void ChangeAsciiCase(const char* src, std::size_t n, char* dst) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), ChangeAsciiCaseBytes32<Upper>(v));
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), ChangeAsciiCaseBytes16<Upper>(v));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = ChangeAsciiCase<Upper>(src[i]);
+    }
+}
+
+// Length of the leading run of ASCII bytes (index of the first byte >= 0x80)
+inline std::size_t AsciiPrefixLength(const char* src, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        if (mask != 0) {
+            return i + std::countr_zero(mask);
+        }
+    }
+#endif
+    while (i < n && static_cast<unsigned char>(src[i]) < 0x80) i++;
+    return i;
+}
+
+// Length of the leading run of ASCII code units (index of the first unit >= 0x80)
+inline std::size_t AsciiPrefixLength(const char16_t* src, std::size_t n) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i mask80 = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), mask80);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(v, _mm_setzero_si128()))) ^ 0xFFFFu;
+        if (mask != 0) {
+            return i + std::countr_zero(mask) / 2;
+        }
+    }
+#endif
+    while (i < n && src[i] < 0x80) i++;
+    return i;
+}
+
+// Full case mapping of UTF-16 text; 'map' is called for non-ASCII units only
+template<bool Upper, typename MapUnit>
+inline void ChangeCase(const char16_t* src, std::size_t n, char16_t* dst, MapUnit map) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    for (; i + 16 <= n; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (_mm256_testz_si256(v, _mm256_set1_epi16(static_cast<short>(0xFF80)))) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), ChangeAsciiCase16<Upper>(v));
+            continue;
+        }
+        for (std::size_t k = i; k < i + 16; k++) {
+            dst[k] = src[k] < 0x80 ? ChangeAsciiCase<Upper>(src[k]) : map(src[k]);
+        }
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    const __m128i mask80 = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask80), _mm_setzero_si128())) == 0xFFFF) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), ChangeAsciiCase8<Upper>(v));
+            continue;
+        }
+        for (std::size_t k = i; k < i + 8; k++) {
+            dst[k] = src[k] < 0x80 ? ChangeAsciiCase<Upper>(src[k]) : map(src[k]);
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = src[i] < 0x80 ? ChangeAsciiCase<Upper>(src[i]) : map(src[i]);
+    }
+}
+
+// Index of the first unit where fold(a[i]) != fold(b[i]), or n. Blocks that
+// are equal as-is, or ASCII in both strings, never call 'fold'
+template<typename FoldUnit>
+inline std::size_t MismatchIgnoreCase(const char16_t* a, const char16_t* b, std::size_t n, FoldUnit fold) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i mask80 = _mm_set1_epi16(static_cast<short>(0xFF80));
+    for (; i + 8 <= n; i += 8) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(va, vb)) == 0xFFFF) {
+            continue;
+        }
+        __m128i high = _mm_and_si128(_mm_or_si128(va, vb), mask80);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF) {
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(FoldAscii8(va), FoldAscii8(vb))));
+            if (mask != 0xFFFFu) {
+                return i + std::countr_zero(~mask) / 2;
+            }
+            continue;
+        }
+        for (std::size_t k = i; k < i + 8; k++) {
+            if (a[k] != b[k] && fold(a[k]) != fold(b[k])) return k;
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        if (a[i] != b[i] && fold(a[i]) != fold(b[i])) return i;
+    }
+    return n;
+}
+
+// ============================================================================
+// Transcoding Kernels
+// UTF-16 <-> UTF-8 and Latin-1 widening/narrowing. Each kernel moves whole
+// ASCII blocks with vector loads/stores and drops to the scalar code only
+// for blocks that contain non-ASCII units. Unpaired surrogates and invalid
+// UTF-8 sequences become U+FFFD.
+// ============================================================================
+
+// Bytes needed to encode the code point starting at src[i]; 'units' receives
+// the number of UTF-16 units it spans (2 for a valid surrogate pair)
+inline std::size_t Utf8SizeAt(const char16_t* src, std::size_t n, std::size_t i, std::size_t& units) {
+    char16_t c = src[i];
+    units = 1;
+    if (c < 0x80) return 1;
+    if (c < 0x800) return 2;
+    if (c >= 0xD800 && c <= 0xDBFF && i + 1 < n && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+        units = 2;
+        return 4;
+    }
+    return 3;
+}
+
+// Encode the code point starting at src[i] into dst; returns UTF-16 units consumed
+inline std::size_t EncodeUtf8At(const char16_t* src, std::size_t n, std::size_t i, char*& dst) {
+    uint32_t c = src[i];
+    if (c < 0x80) {
+        *dst++ = static_cast<char>(c);
+        return 1;
+    }
+    if (c < 0x800) {
+        *dst++ = static_cast<char>(0xC0 | (c >> 6));
+        *dst++ = static_cast<char>(0x80 | (c & 0x3F));
+        return 1;
+    }
+    if (c >= 0xD800 && c <= 0xDFFF) {
+        if (c <= 0xDBFF && i + 1 < n && src[i + 1] >= 0xDC00 && src[i + 1] <= 0xDFFF) {
+            uint32_t cp = 0x10000 + ((c - 0xD800) << 10) + (src[i + 1] - 0xDC00);
+            *dst++ = static_cast<char>(0xF0 | (cp >> 18));
+            *dst++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            *dst++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            *dst++ = static_cast<char>(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        c = 0xFFFD;
+    }
+    *dst++ = static_cast<char>(0xE0 | (c >> 12));
+    *dst++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    *dst++ = static_cast<char>(0x80 | (c & 0x3F));
+    return 1;
+}
+
+// Exact UTF-8 length of UTF-16 input, so the output can be sized once
+inline std::size_t Utf8Length(const char16_t* src, std::size_t n) {
+    std::size_t total = 0;
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask80 = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i mask800 = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i surrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+    while (i + 8 <= n) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i hi5 = _mm_and_si128(v, mask800);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(hi5, surrogate)) != 0) {
+            // Surrogates present: pair them up one code point at a time
+            std::size_t end = i + 8;
+            while (i < end) {
+                std::size_t units;
+                total += Utf8SizeAt(src, n, i, units);
+                i += units;
+            }
+            continue;
+        }
+        // 1 byte per unit, +1 for >= 0x80, +1 more for >= 0x800
+        unsigned ascii = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask80), zero)));
+        unsigned small = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(hi5, zero)));
+        total += 8 + (16 - std::popcount(ascii)) / 2 + (16 - std::popcount(small)) / 2;
+        i += 8;
+    }
+#endif
+    while (i < n) {
+        std::size_t units;
+        total += Utf8SizeAt(src, n, i, units);
+        i += units;
+    }
+    return total;
+}
+
+// Encode UTF-16 as UTF-8; dst must hold Utf8Length(src, n) bytes. Returns bytes written
+inline std::size_t EncodeUtf8(const char16_t* src, std::size_t n, char* dst) {
+    char* out = dst;
+    std::size_t i = 0;
+#if defined(BP_SIMD_AVX2)
+    while (i + 16 <= n) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (!_mm256_testz_si256(v, _mm256_set1_epi16(static_cast<short>(0xFF80)))) {
+            std::size_t end = i + 16;
+            while (i < end) {
+                i += EncodeUtf8At(src, n, i, out);
+            }
+            continue;
+        }
+        __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), bytes);
+        out += 16;
+        i += 16;
+    }
+#endif
+#if defined(BP_SIMD_SSE2)
+    const __m128i mask80 = _mm_set1_epi16(static_cast<short>(0xFF80));
+    while (i + 8 <= n) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, mask80), _mm_setzero_si128())) != 0xFFFF) {
+            std::size_t end = i + 8;
+            while (i < end) {
+                i += EncodeUtf8At(src, n, i, out);
+            }
+            continue;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v, v));
+        out += 8;
+        i += 8;
+    }
+#endif
+    while (i < n) {
+        i += EncodeUtf8At(src, n, i, out);
+    }
+    return static_cast<std::size_t>(out - dst);
+}
+
+// UTF-32 -> UTF-8 (wchar_t text where wchar_t is 32-bit). Surrogates and
+// values above U+10FFFF become U+FFFD
+inline std::size_t Utf8Length(const char32_t* src, std::size_t n) {
+    std::size_t bytes = 0;
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    // ASCII blocks: one byte per unit
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)),
+                                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) != 0xFFFF) {
+            break;
+        }
+        bytes += 8;
+    }
+#endif
+    for (; i < n; i++) {
+        char32_t cp = src[i];
+        bytes += cp < 0x80 ? 1 : cp < 0x800 ? 2 : (cp < 0x10000 || cp > 0x10FFFF) ? 3 : 4;
+    }
+    return bytes;
+}
+
+inline std::size_t EncodeUtf8(const char32_t* src, std::size_t n, char* dst) {
+    char* out = dst;
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    // ASCII blocks: narrow 8 units at a time
+    for (; i + 8 <= n; i += 8) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) != 0xFFFF) {
+            break;
+        }
+        __m128i words = _mm_packs_epi32(a, b);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(words, words));
+        out += 8;
+    }
+#endif
+    for (; i < n; i++) {
+        char32_t cp = src[i];
+        if (cp < 0x80) {
+            *out++ = static_cast<char>(cp);
+            continue;
+        }
+        if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+            cp = 0xFFFD;
+        }
+        if (cp < 0x800) {
+            *out++ = static_cast<char>(0xC0 | (cp >> 6));
+        } else if (cp < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | (cp >> 12));
+            *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        } else {
+            *out++ = static_cast<char>(0xF0 | (cp >> 18));
+            *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        }
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return static_cast<std::size_t>(out - dst);
+}
+
+// Decode the UTF-8 sequence starting at src[i] into a code point; returns
+// bytes consumed. Overlong forms, encoded surrogates, values above U+10FFFF
+// and truncated sequences yield U+FFFD and consume one byte
+inline std::size_t DecodeUtf8At(const unsigned char* src, std::size_t n, std::size_t i, uint32_t& cp) {
+    unsigned char b0 = src[i];
+    if (b0 < 0x80) {
+        cp = b0;
+        return 1;
+    }
+    cp = 0xFFFD;
+    std::size_t need;
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    if (b0 >= 0xC2 && b0 <= 0xDF) {
+        need = 1;
+        cp = b0 & 0x1F;
+    } else if (b0 >= 0xE0 && b0 <= 0xEF) {
+        need = 2;
+        cp = b0 & 0x0F;
+        if (b0 == 0xE0) lo = 0xA0;
+        if (b0 == 0xED) hi = 0x9F;
+    } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+        need = 3;
+        cp = b0 & 0x07;
+        if (b0 == 0xF0) lo = 0x90;
+        if (b0 == 0xF4) hi = 0x8F;
+    } else {
+        return 1;
+    }
+    if (n - i <= need) {
+        cp = 0xFFFD;
+        return 1;
+    }
+    unsigned char b1 = src[i + 1];
+    if (b1 < lo || b1 > hi) {
+        cp = 0xFFFD;
+        return 1;
+    }
+    cp = (cp << 6) | (b1 & 0x3F);
+    for (std::size_t k = 2; k <= need; k++) {
+        unsigned char b = src[i + k];
+        if ((b & 0xC0) != 0x80) {
+            cp = 0xFFFD;
+            return 1;
+        }
+        cp = (cp << 6) | (b & 0x3F);
+    }
+    return need + 1;
+}
+
+// Decode UTF-8 into UTF-16; dst must hold n units (the output never has more
+// units than the input has bytes). Returns units written
+inline std::size_t DecodeUtf8(const char* src, std::size_t n, char16_t* dst) {
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(src);
+    char16_t* out = dst;
+    std::size_t i = 0;
+    while (i < n) {
+#if defined(BP_SIMD_SSE2)
+        // ASCII run: widen 16 bytes at a time
+        while (i + 16 <= n) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            if (_mm_movemask_epi8(v) != 0) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+            out += 16;
+            i += 16;
+        }
+        if (i >= n) break;
+#endif
+        uint32_t cp;
+        i += DecodeUtf8At(in, n, i, cp);
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            *out++ = static_cast<char16_t>(0xD800 + (cp >> 10));
+            *out++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+        } else {
+            *out++ = static_cast<char16_t>(cp);
+        }
+    }
+    return static_cast<std::size_t>(out - dst);
+}
+
+// Byte -> code unit (Latin-1), used by the narrow String constructors
+inline void WidenLatin1(const char* src, std::size_t n, char16_t* dst) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = static_cast<char16_t>(static_cast<unsigned char>(src[i]));
+    }
+}
+
+// Code unit -> low byte, used by ToNarrow (units above 0xFF are truncated)
+inline void NarrowLatin1(const char16_t* src, std::size_t n, char* dst) {
+    std::size_t i = 0;
+#if defined(BP_SIMD_SSE2)
+    const __m128i lowByte = _mm_set1_epi16(0x00FF);
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), lowByte);
+        __m128i b = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8)), lowByte);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = static_cast<char>(src[i]);
+    }
+}
+
+// ============================================================================
+// Hash Kernels
+// The wyhash construction: each step multiplies two 64-bit words into 128
+// bits and folds the halves together. Inputs of 16 bytes or less take one
+// step; longer inputs run three independent multiply chains over 48-byte
+// blocks, which keeps the multiplier busy the way vector lanes would
+// ============================================================================
+
+inline void MultiplyFull(std::uint64_t& a, std::uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    std::uint64_t ha = a >> 32, la = static_cast<std::uint32_t>(a);
+    std::uint64_t hb = b >> 32, lb = static_cast<std::uint32_t>(b);
+    std::uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    std::uint64_t mid = (ll >> 32) + static_cast<std::uint32_t>(hl) + static_cast<std::uint32_t>(lh);
+    a = (mid << 32) | static_cast<std::uint32_t>(ll);
+    b = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+}
+
+inline std::uint64_t HashMix(std::uint64_t a, std::uint64_t b) {
+    MultiplyFull(a, b);
+    return a ^ b;
+}
+
+inline std::uint64_t HashRead8(const unsigned char* p) {
+    std::uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
+}
+
+inline std::uint64_t HashRead4(const unsigned char* p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+// 64-bit hash of n bytes. Not stable across runtime versions; do not persist it
+inline std::uint64_t HashBytes(const void* data, std::size_t n, std::uint64_t seed = 0) {
+    constexpr std::uint64_t s0 = 0x2d358dccaa6c78a5ull;
+    constexpr std::uint64_t s1 = 0x8bb84b93962eacc9ull;
+    constexpr std::uint64_t s2 = 0x4b33a62ed433d4a3ull;
+    constexpr std::uint64_t s3 = 0x4d5a2da51de1aa47ull;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    seed ^= HashMix(seed ^ s0, s1);
+    std::uint64_t a;
+    std::uint64_t b;
+    if (n <= 16) {
+        if (n >= 4) {
+            // Two overlapping 4-byte reads from each end cover 4..16 bytes
+            std::size_t mid = (n >> 3) << 2;
+            a = (HashRead4(p) << 32) | HashRead4(p + mid);
+            b = (HashRead4(p + n - 4) << 32) | HashRead4(p + n - 4 - mid);
+        } else if (n > 0) {
+            a = (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[n >> 1]) << 8) | p[n - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        std::size_t i = n;
+        if (i >= 48) {
+            std::uint64_t see1 = seed;
+            std::uint64_t see2 = seed;
+            do {
+                seed = HashMix(HashRead8(p) ^ s1, HashRead8(p + 8) ^ seed);
+                see1 = HashMix(HashRead8(p + 16) ^ s2, HashRead8(p + 24) ^ see1);
+                see2 = HashMix(HashRead8(p + 32) ^ s3, HashRead8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = HashMix(HashRead8(p) ^ s1, HashRead8(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        // The last 16 bytes, overlapping the previous block when i < 16
+        a = HashRead8(p + i - 16);
+        b = HashRead8(p + i - 8);
+    }
+    a ^= s1;
+    b ^= seed;
+    MultiplyFull(a, b);
+    return HashMix(a ^ s0 ^ n, b ^ s1);
+}
+
+// ============================================================================
+// Numeric Reduction Kernels
+// Sums, sums of squares, deviations and extremes over double, float, int and
+// long long, behind the Math-unit statistics (Sum, Mean, StdDev, Norm, ...).
+// Floating-point totals are compensated (Neumaier) in every lane and the lanes
+// are merged the same way, so the rounding error stays at a few ulps however
+// long the array is. float and int elements are widened to double first
+// ============================================================================
+
+// Running total kept as s + c, where c collects the low-order bits lost by s
+struct CompensatedSum {
+    double s = 0.0;
+    double c = 0.0;
+
+    void Add(double x) {
+        double t = s + x;
+        double as = s < 0 ? -s : s;
+        double ax = x < 0 ? -x : x;
+        c += as >= ax ? (s - t) + x : (x - t) + s;
+        s = t;
+    }
+
+    double Total() const { return s + c; }
+};
+
+#if defined(BP_SIMD_AVX2)
+// Four double lanes. Load widens float and int elements
+struct DoubleLanes {
+    using V = __m256d;
+    static constexpr std::size_t Width = 4;
+    static V Zero() { return _mm256_setzero_pd(); }
+    static V Set(double v) { return _mm256_set1_pd(v); }
+    static V Load(const double* p) { return _mm256_loadu_pd(p); }
+    static V Load(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+    static V Load(const int* p) { return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+    static V Add(V a, V b) { return _mm256_add_pd(a, b); }
+    static V Sub(V a, V b) { return _mm256_sub_pd(a, b); }
+    static V Mul(V a, V b) { return _mm256_mul_pd(a, b); }
+    static V Abs(V a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static V GreaterEqual(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static V Select(V mask, V a, V b) { return _mm256_blendv_pd(b, a, mask); }
+    static void Store(double* p, V v) { _mm256_storeu_pd(p, v); }
+};
+#define BP_SIMD_DOUBLE_LANES 1
+#elif defined(BP_SIMD_SSE2)
+// Two double lanes. Load widens float and int elements
+struct DoubleLanes {
+    using V = __m128d;
+    static constexpr std::size_t Width = 2;
+    static V Zero() { return _mm_setzero_pd(); }
+    static V Set(double v) { return _mm_set1_pd(v); }
+    static V Load(const double* p) { return _mm_loadu_pd(p); }
+    static V Load(const float* p) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))); }
+    static V Load(const int* p) { return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))); }
+    static V Add(V a, V b) { return _mm_add_pd(a, b); }
+    static V Sub(V a, V b) { return _mm_sub_pd(a, b); }
+    static V Mul(V a, V b) { return _mm_mul_pd(a, b); }
+    static V Abs(V a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static V GreaterEqual(V a, V b) { return _mm_cmpge_pd(a, b); }
+    static V Select(V mask, V a, V b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+    static void Store(double* p, V v) { _mm_storeu_pd(p, v); }
+};
+#define BP_SIMD_DOUBLE_LANES 1
+#endif
+
+#if defined(BP_SIMD_DOUBLE_LANES)
+// CompensatedSum, one per lane
+struct CompensatedLanes {
+    DoubleLanes::V s = DoubleLanes::Zero();
+    DoubleLanes::V c = DoubleLanes::Zero();
+
+    void Add(DoubleLanes::V x) {
+        using L = DoubleLanes;
+        L::V t = L::Add(s, x);
+        L::V big = L::GreaterEqual(L::Abs(s), L::Abs(x));
+        c = L::Add(c, L::Select(big, L::Add(L::Sub(s, t), x), L::Add(L::Sub(x, t), s)));
+        s = t;
+    }
+
+    void MergeInto(CompensatedSum& total) const {
+        double ls[DoubleLanes::Width];
+        double lc[DoubleLanes::Width];
+        DoubleLanes::Store(ls, s);
+        DoubleLanes::Store(lc, c);
+        for (std::size_t k = 0; k < DoubleLanes::Width; k++) {
+            total.Add(ls[k]);
+            total.Add(lc[k]);
+        }
+    }
+};
+
+// long long has no packed conversion to double below AVX-512
+template<typename Src>
+inline constexpr bool HasDoubleLanes = !std::is_same_v<Src, long long>;
+#endif
+
+// Compensated sum of the elements (Square = false) or of their squares
+template<bool Square, typename Src>
+inline double SumAsDouble(const Src* p, std::size_t n) {
+    CompensatedSum total;
+    std::size_t i = 0;
+#if defined(BP_SIMD_DOUBLE_LANES)
+    if constexpr (HasDoubleLanes<Src>) {
+        using L = DoubleLanes;
+        // Two independent chains keep the adder busy through its latency
+        CompensatedLanes a;
+        CompensatedLanes b;
+        for (; i + 2 * L::Width <= n; i += 2 * L::Width) {
+            L::V x = L::Load(p + i);
+            L::V y = L::Load(p + i + L::Width);
+            if constexpr (Square) {
+                x = L::Mul(x, x);
+                y = L::Mul(y, y);
+            }
+            a.Add(x);
+            b.Add(y);
+        }
+        a.MergeInto(total);
+        b.MergeInto(total);
+    }
+#endif
+    for (; i < n; i++) {
+        double x = static_cast<double>(p[i]);
+        total.Add(Square ? x * x : x);
+    }
+    return total.Total();
+}
+
+// Compensated sums of d and d * d, where d = x - mean: the second pass of the
+// corrected two-pass variance, which stays accurate when the mean is large
+// compared to the spread
+template<typename Src>
+inline void SumDeviations(const Src* p, std::size_t n, double mean, double& sum, double& sumSquares) {
+    CompensatedSum total;
+    CompensatedSum squares;
+    std::size_t i = 0;
+#if defined(BP_SIMD_DOUBLE_LANES)
+    if constexpr (HasDoubleLanes<Src>) {
+        using L = DoubleLanes;
+        const L::V m = L::Set(mean);
+        CompensatedLanes a;
+        CompensatedLanes b;
+        for (; i + L::Width <= n; i += L::Width) {
+            L::V d = L::Sub(L::Load(p + i), m);
+            a.Add(d);
+            b.Add(L::Mul(d, d));
+        }
+        a.MergeInto(total);
+        b.MergeInto(squares);
+    }
+#endif
+    for (; i < n; i++) {
+        double d = static_cast<double>(p[i]) - mean;
+        total.Add(d);
+        squares.Add(d * d);
+    }
+    sum = total.Total();
+    sumSquares = squares.Total();
+}
+
+// Exact sum of 32-bit integers, accumulated in 64-bit lanes
+inline long long SumIntegers(const int* p, std::size_t n) {
+    std::size_t i = 0;
+    long long total = 0;
+#if defined(BP_SIMD_AVX2)
+    if (n >= 8) {
+        __m256i a = _mm256_setzero_si256();
+        __m256i b = _mm256_setzero_si256();
+        for (; i + 8 <= n; i += 8) {
+            a = _mm256_add_epi64(a, _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i))));
+            b = _mm256_add_epi64(b, _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 4))));
+        }
+        long long lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(a, b));
+        total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+#elif defined(BP_SIMD_SSE2)
+    if (n >= 4) {
+        __m128i a = _mm_setzero_si128();
+        __m128i b = _mm_setzero_si128();
+        for (; i + 4 <= n; i += 4) {
+            // Sign-extend by interleaving each element with its sign word
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i sign = _mm_srai_epi32(v, 31);
+            a = _mm_add_epi64(a, _mm_unpacklo_epi32(v, sign));
+            b = _mm_add_epi64(b, _mm_unpackhi_epi32(v, sign));
+        }
+        long long lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(a, b));
+        total = lanes[0] + lanes[1];
+    }
+#endif
+    for (; i < n; i++) total += p[i];
+    return total;
+}
+
+// Sum of 64-bit integers, wrapping on overflow as Int64 addition does
+inline long long SumIntegers(const long long* p, std::size_t n) {
+    std::size_t i = 0;
+    std::uint64_t total = 0;
+#if defined(BP_SIMD_AVX2)
+    if (n >= 8) {
+        __m256i a = _mm256_setzero_si256();
+        __m256i b = _mm256_setzero_si256();
+        for (; i + 8 <= n; i += 8) {
+            a = _mm256_add_epi64(a, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+            b = _mm256_add_epi64(b, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 4)));
+        }
+        std::uint64_t lanes[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(a, b));
+        total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+#elif defined(BP_SIMD_SSE2)
+    if (n >= 4) {
+        __m128i a = _mm_setzero_si128();
+        __m128i b = _mm_setzero_si128();
+        for (; i + 4 <= n; i += 4) {
+            a = _mm_add_epi64(a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+            b = _mm_add_epi64(b, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 2)));
+        }
+        std::uint64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(a, b));
+        total = lanes[0] + lanes[1];
+    }
+#endif
+    for (; i < n; i++) total += static_cast<std::uint64_t>(p[i]);
+    return static_cast<long long>(total);
+}
+
+// Replace r with x if x is smaller (Max = false) or larger (Max = true). This
+// is Delphi's MinValue/MaxValue loop: a NaN never replaces a number, and a
+// NaN in the first element is kept
+template<bool Max, typename T>
+inline void Pick(T& r, T x) {
+    if (Max ? x > r : x < r) r = x;
+}
+
+// Smallest or largest of n > 0 elements. The packed min/max instructions
+// return their second operand when either is NaN, which gives each lane the
+// same NaN behaviour as Pick
+template<bool Max>
+inline double Extreme(const double* p, std::size_t n) {
+    double r = p[0];
+    std::size_t i = 1;
+#if defined(BP_SIMD_AVX2)
+    if (n >= 8) {
+        __m256d a = _mm256_set1_pd(r);
+        __m256d b = a;
+        for (i = 0; i + 8 <= n; i += 8) {
+            __m256d x = _mm256_loadu_pd(p + i);
+            __m256d y = _mm256_loadu_pd(p + i + 4);
+            a = Max ? _mm256_max_pd(x, a) : _mm256_min_pd(x, a);
+            b = Max ? _mm256_max_pd(y, b) : _mm256_min_pd(y, b);
+        }
+        double lanes[8];
+        _mm256_storeu_pd(lanes, a);
+        _mm256_storeu_pd(lanes + 4, b);
+        for (double v : lanes) Pick<Max>(r, v);
+    }
+#elif defined(BP_SIMD_SSE2)
+    if (n >= 4) {
+        __m128d a = _mm_set1_pd(r);
+        __m128d b = a;
+        for (i = 0; i + 4 <= n; i += 4) {
+            __m128d x = _mm_loadu_pd(p + i);
+            __m128d y = _mm_loadu_pd(p + i + 2);
+            a = Max ? _mm_max_pd(x, a) : _mm_min_pd(x, a);
+            b = Max ? _mm_max_pd(y, b) : _mm_min_pd(y, b);
+        }
+        double lanes[4];
+        _mm_storeu_pd(lanes, a);
+        _mm_storeu_pd(lanes + 2, b);
+        for (double v : lanes) Pick<Max>(r, v);
+    }
+#endif
+    for (; i < n; i++) Pick<Max>(r, p[i]);
+    return r;
+}
+
+template<bool Max>
+inline float Extreme(const float* p, std::size_t n) {
+    float r = p[0];
+    std::size_t i = 1;
+#if defined(BP_SIMD_AVX2)
+    if (n >= 16) {
+        __m256 a = _mm256_set1_ps(r);
+        __m256 b = a;
+        for (i = 0; i + 16 <= n; i += 16) {
+            __m256 x = _mm256_loadu_ps(p + i);
+            __m256 y = _mm256_loadu_ps(p + i + 8);
+            a = Max ? _mm256_max_ps(x, a) : _mm256_min_ps(x, a);
+            b = Max ? _mm256_max_ps(y, b) : _mm256_min_ps(y, b);
+        }
+        float lanes[16];
+        _mm256_storeu_ps(lanes, a);
+        _mm256_storeu_ps(lanes + 8, b);
+        for (float v : lanes) Pick<Max>(r, v);
+    }
+#elif defined(BP_SIMD_SSE2)
+    if (n >= 8) {
+        __m128 a = _mm_set1_ps(r);
+        __m128 b = a;
+        for (i = 0; i + 8 <= n; i += 8) {
+            __m128 x = _mm_loadu_ps(p + i);
+            __m128 y = _mm_loadu_ps(p + i + 4);
+            a = Max ? _mm_max_ps(x, a) : _mm_min_ps(x, a);
+            b = Max ? _mm_max_ps(y, b) : _mm_min_ps(y, b);
+        }
+        float lanes[8];
+        _mm_storeu_ps(lanes, a);
+        _mm_storeu_ps(lanes + 4, b);
+        for (float v : lanes) Pick<Max>(r, v);
+    }
+#endif
+    for (; i < n; i++) Pick<Max>(r, p[i]);
+    return r;
+}
+
+template<bool Max>
+inline int Extreme(const int* p, std::size_t n) {
+    int r = p[0];
+    std::size_t i = 1;
+#if defined(BP_SIMD_AVX2)
+    if (n >= 16) {
+        __m256i a = _mm256_set1_epi32(r);
+        __m256i b = a;
+        for (i = 0; i + 16 <= n; i += 16) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 8));
+            a = Max ? _mm256_max_epi32(a, x) : _mm256_min_epi32(a, x);
+            b = Max ? _mm256_max_epi32(b, y) : _mm256_min_epi32(b, y);
+        }
+        int lanes[16];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 8), b);
+        for (int v : lanes) Pick<Max>(r, v);
+    }
+#elif defined(BP_SIMD_SSE2)
+    if (n >= 8) {
+        // SSE2 has no pminsd/pmaxsd: keep a lane where the compare says so
+        __m128i a = _mm_set1_epi32(r);
+        __m128i b = a;
+        for (i = 0; i + 8 <= n; i += 8) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 4));
+            __m128i ka = Max ? _mm_cmpgt_epi32(a, x) : _mm_cmplt_epi32(a, x);
+            __m128i kb = Max ? _mm_cmpgt_epi32(b, y) : _mm_cmplt_epi32(b, y);
+            a = _mm_or_si128(_mm_and_si128(ka, a), _mm_andnot_si128(ka, x));
+            b = _mm_or_si128(_mm_and_si128(kb, b), _mm_andnot_si128(kb, y));
+        }
+        int lanes[8];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), a);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes + 4), b);
+        for (int v : lanes) Pick<Max>(r, v);
+    }
+#endif
+    for (; i < n; i++) Pick<Max>(r, p[i]);
+    return r;
+}
+
+template<bool Max>
+inline long long Extreme(const long long* p, std::size_t n) {
+    long long r = p[0];
+    std::size_t i = 1;
+#if defined(BP_SIMD_AVX2)
+    if (n >= 8) {
+        __m256i a = _mm256_set1_epi64x(r);
+        __m256i b = a;
+        for (i = 0; i + 8 <= n; i += 8) {
+            __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i + 4));
+            __m256i ka = Max ? _mm256_cmpgt_epi64(x, a) : _mm256_cmpgt_epi64(a, x);
+            __m256i kb = Max ? _mm256_cmpgt_epi64(y, b) : _mm256_cmpgt_epi64(b, y);
+            a = _mm256_blendv_epi8(a, x, ka);
+            b = _mm256_blendv_epi8(b, y, kb);
+        }
+        long long lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes + 4), b);
+        for (long long v : lanes) Pick<Max>(r, v);
+    }
+#endif
+    for (; i < n; i++) Pick<Max>(r, p[i]);
+    return r;
+}
+
+} // namespace simd
+} // namespace bp
@@ -0,0 +1,735 @@
+/*******************************************************************************
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+*******************************************************************************/
+
+// runtime_sort.h - TArray.Sort and TArray.BinarySearch (System.Generics.Collections)
+// Sorting is a pattern-defeating quicksort (pdqsort) for any ordering, an LSD
+// radix sort for large arrays of integer and float keys, and chunks sorted on
+// several threads then merged for very large arrays in their default order
+
+#pragma once
+
+#include "runtime_types.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bp {
+
+namespace internal {
+
+// ============================================================================
+// Sort keys - the raw number behind each runtime numeric type
+// ============================================================================
+inline int SortKey(const Integer& v) { return v.ToInt(); }
+inline long long SortKey(const Int64& v) { return v.ToInt64(); }
+inline unsigned long long SortKey(const UInt64& v) { return v.ToUInt64(); }
+inline unsigned int SortKey(const Cardinal& v) { return v.ToCardinal(); }
+inline unsigned char SortKey(const Byte& v) { return v.ToByte(); }
+inline unsigned short SortKey(const Word& v) { return v.ToWord(); }
+inline signed char SortKey(const ShortInt& v) { return v.ToShortInt(); }
+inline short SortKey(const SmallInt& v) { return v.ToSmallInt(); }
+inline float SortKey(const Single& v) { return v.ToFloat(); }
+inline double SortKey(const Double& v) { return v.ToDouble(); }
+inline char16_t SortKey(const Char& v) { return v.ToChar16(); }
+
+template<typename T> requires std::is_arithmetic_v<T>
+inline T SortKey(T v) { return v; }
+
+// Key behind X, or void when X has none (strings, records)
+template<typename X>
+struct SortKeyOf { using Type = void; };
+
+template<typename X> requires requires(const X& v) { SortKey(v); }
+struct SortKeyOf<X> { using Type = std::remove_cvref_t<decltype(SortKey(std::declval<const X&>()))>; };
+
+template<typename K>
+concept RadixKey = std::is_arithmetic_v<K> && !std::is_same_v<K, bool> &&
+    (!std::is_floating_point_v<K> || sizeof(K) == 4 || sizeof(K) == 8);
+
+// T is sorted by value through its key: radix sort and branchless partitioning
+template<typename T>
+concept RadixSortable = std::is_trivially_copyable_v<T> &&
+    requires(const T& v) { SortKey(v); } &&
+    RadixKey<std::remove_cvref_t<decltype(SortKey(std::declval<const T&>()))>>;
+
+// Unsigned bits that order like the key (sign flipped; negative floats inverted)
+template<typename K>
+inline auto RadixBits(K key) {
+    if constexpr (std::is_floating_point_v<K>) {
+        using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+        constexpr U Sign = U(1) << (sizeof(U) * 8 - 1);
+        U bits = std::bit_cast<U>(key);
+        return (bits & Sign) ? static_cast<U>(~bits) : static_cast<U>(bits | Sign);
+    } else {
+        using U = std::make_unsigned_t<K>;
+        if constexpr (std::is_signed_v<K>)
+            return static_cast<U>(static_cast<U>(key) ^ (U(1) << (sizeof(U) * 8 - 1)));
+        else
+            return static_cast<U>(key);
+    }
+}
+
+// Radix sort pays for its extra pass over memory once arrays get this long.
+// With 8-byte keys its eight scatter passes stop paying off past ~500K elements
+template<typename K>
+inline constexpr std::size_t RadixThreshold = sizeof(K) <= 4 ? 1024 : 4096;
+
+template<typename K>
+inline constexpr std::size_t RadixLimit = sizeof(K) <= 4 ? SIZE_MAX : std::size_t(1) << 19;
+
+constexpr std::size_t ParallelThreshold = std::size_t(1) << 18;
+constexpr std::size_t ParallelMinChunk = std::size_t(1) << 16;
+
+struct DefaultLess {
+    template<typename A, typename B>
+    bool operator()(const A& a, const B& b) const { return a < b; }
+};
+
+// ============================================================================
+// Pattern-defeating quicksort (Orson Peters): median-of-3 / ninther pivots,
+// insertion sort for short and nearly sorted ranges, equal-element partitions,
+// and heapsort once too many partitions come out unbalanced
+// ============================================================================
+constexpr std::ptrdiff_t InsertionSortThreshold = 24;
+constexpr std::ptrdiff_t NintherThreshold = 128;
+constexpr std::ptrdiff_t PartialInsertionSortLimit = 8;
+constexpr std::size_t PartitionBlockSize = 64;
+
+template<typename T, typename Compare>
+inline void InsertionSort(T* begin, T* end, Compare& comp) {
+    if (begin == end) return;
+    for (T* cur = begin + 1; cur != end; ++cur) {
+        T* sift = cur;
+        T* sift1 = cur - 1;
+        if (comp(*sift, *sift1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift1);
+            } while (sift != begin && comp(tmp, *--sift1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Requires *(begin - 1) to be no greater than any element of [begin, end)
+template<typename T, typename Compare>
+inline void UnguardedInsertionSort(T* begin, T* end, Compare& comp) {
+    if (begin == end) return;
+    for (T* cur = begin + 1; cur != end; ++cur) {
+        T* sift = cur;
+        T* sift1 = cur - 1;
+        if (comp(*sift, *sift1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift1);
+            } while (comp(tmp, *--sift1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Insertion sort that gives up (returns false) after a few element moves
+template<typename T, typename Compare>
+inline bool PartialInsertionSort(T* begin, T* end, Compare& comp) {
+    if (begin == end) return true;
+    std::ptrdiff_t moved = 0;
+    for (T* cur = begin + 1; cur != end; ++cur) {
+        T* sift = cur;
+        T* sift1 = cur - 1;
+        if (comp(*sift, *sift1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift1);
+            } while (sift != begin && comp(tmp, *--sift1));
+            *sift = std::move(tmp);
+            moved += cur - sift;
+        }
+        if (moved > PartialInsertionSortLimit) return false;
+    }
+    return true;
+}
+
+template<typename T, typename Compare>
+inline void Sort2(T* a, T* b, Compare& comp) {
+    if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+template<typename T, typename Compare>
+inline void Sort3(T* a, T* b, T* c, Compare& comp) {
+    Sort2(a, b, comp);
+    Sort2(b, c, comp);
+    Sort2(a, b, comp);
+}
+
+// Partition [begin, end) around the pivot *begin: elements < pivot go left.
+// Returns the pivot's final place and whether the range was already partitioned
+template<typename T, typename Compare>
+inline std::pair<T*, bool> PartitionRight(T* begin, T* end, Compare& comp) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    // The median-of-3 guarantees an element >= pivot exists on the right
+    while (comp(*++first, pivot));
+    if (first - 1 == begin)
+        while (first < last && !comp(*--last, pivot));
+    else
+        while (!comp(*--last, pivot));
+
+    bool alreadyPartitioned = first >= last;
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(*++first, pivot));
+        while (!comp(*--last, pivot));
+    }
+
+    T* pivotPos = first - 1;
+    *begin = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return { pivotPos, alreadyPartitioned };
+}
+
+template<typename T>
+inline void SwapOffsets(T* first, T* last, const unsigned char* offsetsL, const unsigned char* offsetsR,
+                        std::size_t num, bool useSwaps) {
+    if (useSwaps) {
+        // Equal counts on both sides: the cyclic permutation below would not
+        // restore the last element, so swap pairwise
+        for (std::size_t i = 0; i < num; ++i)
+            std::iter_swap(first + offsetsL[i], last - offsetsR[i]);
+    } else if (num > 0) {
+        T* l = first + offsetsL[0];
+        T* r = last - offsetsR[0];
+        T tmp(std::move(*l));
+        *l = std::move(*r);
+        for (std::size_t i = 1; i < num; ++i) {
+            l = first + offsetsL[i];
+            *r = std::move(*l);
+            r = last - offsetsR[i];
+            *l = std::move(*r);
+        }
+        *r = std::move(tmp);
+    }
+}
+
+// PartitionRight with the comparisons turned into offset buffers (BlockQuicksort),
+// so the partition loop has no data-dependent branches. For cheap comparisons only
+template<typename T, typename Compare>
+inline std::pair<T*, bool> PartitionRightBranchless(T* begin, T* end, Compare& comp) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    while (comp(*++first, pivot));
+    if (first - 1 == begin)
+        while (first < last && !comp(*--last, pivot));
+    else
+        while (!comp(*--last, pivot));
+
+    bool alreadyPartitioned = first >= last;
+    if (!alreadyPartitioned) {
+        std::iter_swap(first, last);
+        ++first;
+
+        alignas(64) unsigned char offsetsLStorage[PartitionBlockSize];
+        alignas(64) unsigned char offsetsRStorage[PartitionBlockSize];
+        unsigned char* offsetsL = offsetsLStorage;
+        unsigned char* offsetsR = offsetsRStorage;
+        T* offsetsLBase = first;
+        T* offsetsRBase = last;
+        std::size_t numL = 0, numR = 0, startL = 0, startR = 0;
+
+        while (first < last) {
+            // Fill whichever offset buffer is empty (both: split the unknown range)
+            std::size_t numUnknown = static_cast<std::size_t>(last - first);
+            std::size_t leftSplit = numL == 0 ? (numR == 0 ? numUnknown / 2 : numUnknown) : 0;
+            std::size_t rightSplit = numR == 0 ? (numUnknown - leftSplit) : 0;
+
+            std::size_t leftCount = std::min(leftSplit, PartitionBlockSize);
+            for (std::size_t i = 0; i < leftCount; ++i) {
+                offsetsL[numL] = static_cast<unsigned char>(i);
+                numL += !comp(*first, pivot);
+                ++first;
+            }
+            std::size_t rightCount = std::min(rightSplit, PartitionBlockSize);
+            for (std::size_t i = 0; i < rightCount;) {
+                offsetsR[numR] = static_cast<unsigned char>(++i);
+                numR += comp(*--last, pivot);
+            }
+
+            // Swap misplaced pairs, then restart whichever buffer ran out
+            std::size_t num = std::min(numL, numR);
+            SwapOffsets(offsetsLBase, offsetsRBase, offsetsL + startL, offsetsR + startR, num, numL == numR);
+            numL -= num;
+            numR -= num;
+            startL += num;
+            startR += num;
+            if (numL == 0) {
+                startL = 0;
+                offsetsLBase = first;
+            }
+            if (numR == 0) {
+                startR = 0;
+                offsetsRBase = last;
+            }
+        }
+
+        // One buffer may still hold misplaced elements; move them to the boundary
+        if (numL) {
+            offsetsL += startL;
+            while (numL--) std::iter_swap(offsetsLBase + offsetsL[numL], --last);
+            first = last;
+        }
+        if (numR) {
+            offsetsR += startR;
+            while (numR--) std::iter_swap(offsetsRBase - offsetsR[numR], first), ++first;
+            last = first;
+        }
+    }
+
+    T* pivotPos = first - 1;
+    *begin = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return { pivotPos, alreadyPartitioned };
+}
+
+// Partition with elements equal to the pivot going left. Used when the pivot
+// equals the element before the range, so the whole left part is one value
+template<typename T, typename Compare>
+inline T* PartitionLeft(T* begin, T* end, Compare& comp) {
+    T pivot(std::move(*begin));
+    T* first = begin;
+    T* last = end;
+
+    while (comp(pivot, *--last));
+    if (last + 1 == end)
+        while (first < last && !comp(pivot, *++first));
+    else
+        while (!comp(pivot, *++first));
+
+    while (first < last) {
+        std::iter_swap(first, last);
+        while (comp(pivot, *--last));
+        while (!comp(pivot, *++first));
+    }
+
+    T* pivotPos = last;
+    *begin = std::move(*pivotPos);
+    *pivotPos = std::move(pivot);
+    return pivotPos;
+}
+
+template<bool Branchless, typename T, typename Compare>
+void PdqSortLoop(T* begin, T* end, Compare& comp, int badAllowed, bool leftmost) {
+    while (true) {
+        std::ptrdiff_t size = end - begin;
+        if (size < InsertionSortThreshold) {
+            if (leftmost)
+                InsertionSort(begin, end, comp);
+            else
+                UnguardedInsertionSort(begin, end, comp);
+            return;
+        }
+
+        // Pivot: median of 3, or pseudo-median of 9 (ninther) for larger ranges
+        std::ptrdiff_t half = size / 2;
+        if (size > NintherThreshold) {
+            Sort3(begin, begin + half, end - 1, comp);
+            Sort3(begin + 1, begin + (half - 1), end - 2, comp);
+            Sort3(begin + 2, begin + (half + 1), end - 3, comp);
+            Sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+            std::iter_swap(begin, begin + half);
+        } else {
+            Sort3(begin + half, begin, end - 1, comp);
+        }
+
+        // Pivot equal to the element before the range: every element equal to
+        // it belongs here, so split them off and only sort what is greater
+        if (!leftmost && !comp(*(begin - 1), *begin)) {
+            begin = PartitionLeft(begin, end, comp) + 1;
+            continue;
+        }
+
+        auto [pivotPos, alreadyPartitioned] = Branchless
+            ? PartitionRightBranchless(begin, end, comp)
+            : PartitionRight(begin, end, comp);
+
+        std::ptrdiff_t leftSize = pivotPos - begin;
+        std::ptrdiff_t rightSize = end - (pivotPos + 1);
+        bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+        if (highlyUnbalanced) {
+            // Too many bad pivots: finish with guaranteed O(n log n)
+            if (--badAllowed == 0) {
+                std::make_heap(begin, end, comp);
+                std::sort_heap(begin, end, comp);
+                return;
+            }
+
+            // Break up patterns that fool the pivot choice
+            if (leftSize >= InsertionSortThreshold) {
+                std::iter_swap(begin, begin + leftSize / 4);
+                std::iter_swap(pivotPos - 1, pivotPos - leftSize / 4);
+                if (leftSize > NintherThreshold) {
+                    std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+                    std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+                    std::iter_swap(pivotPos - 2, pivotPos - (leftSize / 4 + 1));
+                    std::iter_swap(pivotPos - 3, pivotPos - (leftSize / 4 + 2));
+                }
+            }
+            if (rightSize >= InsertionSortThreshold) {
+                std::iter_swap(pivotPos + 1, pivotPos + (1 + rightSize / 4));
+                std::iter_swap(end - 1, end - rightSize / 4);
+                if (rightSize > NintherThreshold) {
+                    std::iter_swap(pivotPos + 2, pivotPos + (2 + rightSize / 4));
+                    std::iter_swap(pivotPos + 3, pivotPos + (3 + rightSize / 4));
+                    std::iter_swap(end - 2, end - (1 + rightSize / 4));
+                    std::iter_swap(end - 3, end - (2 + rightSize / 4));
+                }
+            }
+        } else if (alreadyPartitioned &&
+                   PartialInsertionSort(begin, pivotPos, comp) &&
+                   PartialInsertionSort(pivotPos + 1, end, comp)) {
+            // Already sorted, or nearly so
+            return;
+        }
+
+        // Recurse into the left part, loop on the right one
+        PdqSortLoop<Branchless>(begin, pivotPos, comp, badAllowed, leftmost);
+        begin = pivotPos + 1;
+        leftmost = false;
+    }
+}
+
+template<typename T, typename Compare>
+inline void PdqSort(T* begin, T* end, Compare comp) {
+    if (end - begin < 2) return;
+    int badAllowed = std::bit_width(static_cast<std::size_t>(end - begin));
+    constexpr bool Branchless = std::is_same_v<Compare, DefaultLess> &&
+        (std::is_arithmetic_v<T> || RadixSortable<T>);
+    PdqSortLoop<Branchless>(begin, end, comp, badAllowed, true);
+}
+
+// ============================================================================
+// LSD radix sort, one byte per pass. Passes where every key has the same
+// byte are skipped, so small ranges of values cost fewer passes. Stable
+// ============================================================================
+template<typename T, typename Bits>
+void RadixSort(T* values, std::size_t count, T* scratch, Bits bitsOf) {
+    using U = decltype(bitsOf(values[0]));
+    constexpr int Passes = static_cast<int>(sizeof(U));
+
+    std::size_t counts[Passes][256] = {};
+    for (std::size_t i = 0; i < count; ++i) {
+        U bits = bitsOf(values[i]);
+        for (int p = 0; p < Passes; ++p)
+            ++counts[p][(bits >> (p * 8)) & 0xFF];
+    }
+
+    T* src = values;
+    T* dst = scratch;
+    U firstBits = bitsOf(values[0]);
+    for (int p = 0; p < Passes; ++p) {
+        if (counts[p][(firstBits >> (p * 8)) & 0xFF] == count)
+            continue;
+
+        std::size_t offsets[256];
+        std::size_t sum = 0;
+        for (int b = 0; b < 256; ++b) {
+            offsets[b] = sum;
+            sum += counts[p][b];
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            std::memcpy(static_cast<void*>(dst + offsets[(bitsOf(src[i]) >> (p * 8)) & 0xFF]++),
+                        static_cast<const void*>(src + i), sizeof(T));
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != values)
+        std::memcpy(static_cast<void*>(values), static_cast<const void*>(src), count * sizeof(T));
+}
+
+template<typename T>
+class ScratchBuffer {
+private:
+    T* data;
+    std::size_t size;
+
+public:
+    explicit ScratchBuffer(std::size_t n) : data(std::allocator<T>().allocate(n)), size(n) {}
+    ~ScratchBuffer() { std::allocator<T>().deallocate(data, size); }
+    ScratchBuffer(const ScratchBuffer&) = delete;
+    ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+    T* Data() const { return data; }
+};
+
+// ============================================================================
+// Parallel sort: sort equal chunks on their own threads, then merge pairs of
+// neighbouring runs (also in parallel) until one run is left
+// ============================================================================
+
+// Runs task(0..count-1), task 0 on the calling thread. An exception from any
+// task is rethrown here once all of them have finished
+template<typename Task>
+void RunTasks(std::size_t count, Task& task) {
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(count);
+    threads.reserve(count);
+    for (std::size_t i = 1; i < count; ++i) {
+        try {
+            threads.emplace_back([&task, &errors, i] {
+                try { task(i); } catch (...) { errors[i] = std::current_exception(); }
+            });
+        } catch (...) {
+            // No thread available: run it here instead
+            try { task(i); } catch (...) { errors[i] = std::current_exception(); }
+        }
+    }
+    try { task(0); } catch (...) { errors[0] = std::current_exception(); }
+    for (auto& t : threads) t.join();
+    for (auto& e : errors)
+        if (e) std::rethrow_exception(e);
+}
+
+inline std::size_t SortThreads(std::size_t count) {
+    if (count < ParallelThreshold) return 1;
+    std::size_t hw = std::thread::hardware_concurrency();
+    return std::max<std::size_t>(1, std::min({ hw, count / ParallelMinChunk, std::size_t(16) }));
+}
+
+template<typename T, typename ChunkSort, typename Compare>
+void ParallelSort(T* values, std::size_t count, std::size_t parts, ChunkSort& sortChunk, Compare comp) {
+    std::vector<std::size_t> bounds(parts + 1);
+    for (std::size_t i = 0; i <= parts; ++i)
+        bounds[i] = count * i / parts;
+
+    auto sortTask = [&](std::size_t i) { sortChunk(values + bounds[i], values + bounds[i + 1]); };
+    RunTasks(parts, sortTask);
+
+    while (bounds.size() > 2) {
+        std::size_t runs = bounds.size() - 1;
+        auto mergeTask = [&](std::size_t i) {
+            std::size_t b = i * 2;
+            if (b + 2 < bounds.size())
+                std::inplace_merge(values + bounds[b], values + bounds[b + 1], values + bounds[b + 2], comp);
+        };
+        RunTasks(runs / 2, mergeTask);
+
+        std::vector<std::size_t> merged;
+        for (std::size_t b = 0; b < bounds.size(); b += 2)
+            merged.push_back(bounds[b]);
+        if (merged.back() != count)
+            merged.push_back(count);
+        bounds = std::move(merged);
+    }
+}
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+// Default order: radix sort for number keys, pdqsort otherwise
+template<typename T>
+void SortSerial(T* first, T* last) {
+    std::size_t count = static_cast<std::size_t>(last - first);
+    if constexpr (RadixSortable<T>) {
+        using K = std::remove_cvref_t<decltype(SortKey(std::declval<const T&>()))>;
+        // (sorted input costs pdqsort one linear pass; radix would still do all of them)
+        if (count >= RadixThreshold<K> && count <= RadixLimit<K> &&
+            !std::is_sorted(first, last, DefaultLess{})) {
+            ScratchBuffer<T> scratch(count);
+            RadixSort(first, count, scratch.Data(), [](const T& v) { return RadixBits(SortKey(v)); });
+            return;
+        }
+    }
+    PdqSort(first, last, DefaultLess{});
+}
+
+template<typename T>
+void SortValues(T* first, T* last) {
+    std::size_t count = static_cast<std::size_t>(last - first);
+    std::size_t parts = SortThreads(count);
+    if (parts > 1) {
+        auto chunk = [](T* b, T* e) { SortSerial(b, e); };
+        ParallelSort(first, count, parts, chunk, DefaultLess{});
+    } else {
+        SortSerial(first, last);
+    }
+}
+
+// Delphi comparer: negative, zero or positive (Integer or any integer type)
+template<typename T, typename Comparer>
+void SortCompared(T* first, T* last, Comparer& comparer) {
+    PdqSort(first, last, [&comparer](const T& a, const T& b) {
+        return static_cast<int>(comparer(a, b)) < 0;
+    });
+}
+
+// Key function: order records by one field. Number keys of large arrays are
+// radix sorted as (key, index) pairs and the records then moved into place
+template<typename T, typename KeyOf>
+void SortByKey(T* first, T* last, KeyOf& keyOf) {
+    using K = typename SortKeyOf<std::remove_cvref_t<decltype(keyOf(*first))>>::Type;
+    std::size_t count = static_cast<std::size_t>(last - first);
+    if constexpr (RadixKey<K>) {
+        if (count >= RadixThreshold<K> && count <= RadixLimit<K> && count <= 0xFFFFFFFFu) {
+            using U = decltype(RadixBits(std::declval<K>()));
+            struct Keyed { U bits; std::uint32_t index; };
+            std::vector<Keyed> keys(count);
+            for (std::size_t i = 0; i < count; ++i)
+                keys[i] = Keyed{ RadixBits(SortKey(keyOf(first[i]))), static_cast<std::uint32_t>(i) };
+            ScratchBuffer<Keyed> scratch(count);
+            RadixSort(keys.data(), count, scratch.Data(), [](const Keyed& k) { return k.bits; });
+
+            std::vector<T> sorted;
+            sorted.reserve(count);
+            for (const Keyed& k : keys)
+                sorted.push_back(std::move(first[k.index]));
+            std::move(sorted.begin(), sorted.end(), first);
+            return;
+        }
+    }
+    PdqSort(first, last, [&keyOf](const T& a, const T& b) {
+        return keyOf(a) < keyOf(b);
+    });
+}
+
+template<typename T, typename Fn>
+void SortWith(T* first, T* last, Fn& fn) {
+    if constexpr (std::is_invocable_v<Fn&, const T&, const T&>)
+        SortCompared(first, last, fn);
+    else
+        SortByKey(first, last, fn);
+}
+
+// Elements of anything TArray accepts, as a view
+template<typename T>
+inline OpenArray<T> SortElements(Array<T>& a) { return a; }
+
+template<typename T>
+inline OpenArray<const T> SortElements(const Array<T>& a) { return a; }
+
+template<typename T, std::size_t N>
+inline OpenArray<T> SortElements(StaticArray<T, N>& a) { return a; }
+
+template<typename T, std::size_t N>
+inline OpenArray<const T> SortElements(const StaticArray<T, N>& a) { return a; }
+
+template<typename T>
+inline OpenArray<T> SortElements(OpenArray<T> a) { return a; }
+
+template<typename T>
+inline OpenArray<T> SortElements(MatrixRow<T> row) { return row; }
+
+// Clip Index/Count to the array, as Copy and Delete do
+inline void SortRange(int length, int& index, int& count) {
+    if (index < 0) {
+        count += index;
+        index = 0;
+    }
+    if (index > length) index = length;
+    if (count > length - index) count = length - index;
+    if (count < 0) count = 0;
+}
+
+template<typename T, typename Less>
+inline bool BinarySearchIn(const T* first, const T* last, const T* base, const T& item, int& found, Less less) {
+    const T* pos = std::lower_bound(first, last, item, less);
+    found = static_cast<int>(pos - base);
+    return pos != last && !less(item, *pos);
+}
+
+} // namespace internal
+
+// ============================================================================
+// TArray - Delphi's TArray.Sort<T> / TArray.BinarySearch<T>
+// Accepts dynamic arrays, static arrays and open array parameters. Besides a
+// Delphi-style comparer (function(const L, R: T): Integer) Sort also takes a
+// key function (function(const Item: T): TKey) to order records by one field.
+// BinarySearch returns the first match; when nothing matches FoundIndex is
+// where Item would be inserted
+// ============================================================================
+class TArray {
+public:
+    template<typename A>
+    static void Sort(A&& values) {
+        auto view = internal::SortElements(values);
+        internal::SortValues(view.begin(), view.end());
+    }
+
+    template<typename A, typename Fn>
+    static void Sort(A&& values, Fn comparer) {
+        auto view = internal::SortElements(values);
+        internal::SortWith(view.begin(), view.end(), comparer);
+    }
+
+    template<typename A, typename Fn, internal::MatrixIndexType I, internal::MatrixIndexType C>
+    static void Sort(A&& values, Fn comparer, const I& index, const C& count) {
+        auto view = internal::SortElements(values);
+        int first = internal::MatrixIndex(index);
+        int n = internal::MatrixIndex(count);
+        internal::SortRange(view.Length(), first, n);
+        internal::SortWith(view.begin() + first, view.begin() + first + n, comparer);
+    }
+
+    template<typename A, typename T, typename F>
+    static bool BinarySearch(const A& values, const T& item, F& foundIndex) {
+        auto view = internal::SortElements(values);
+        using E = std::remove_const_t<std::remove_pointer_t<decltype(view.Data())>>;
+        int found = 0;
+        bool result = internal::BinarySearchIn<E>(view.begin(), view.end(), view.begin(), item, found, internal::DefaultLess{});
+        foundIndex = found;
+        return result;
+    }
+
+    template<typename A, typename T, typename F, typename Fn>
+    static bool BinarySearch(const A& values, const T& item, F& foundIndex, Fn comparer) {
+        auto view = internal::SortElements(values);
+        return BinarySearchRange(view, item, foundIndex, comparer, 0, view.Length());
+    }
+
+    template<typename A, typename T, typename F, typename Fn, internal::MatrixIndexType I, internal::MatrixIndexType C>
+    static bool BinarySearch(const A& values, const T& item, F& foundIndex, Fn comparer, const I& index, const C& count) {
+        auto view = internal::SortElements(values);
+        int first = internal::MatrixIndex(index);
+        int n = internal::MatrixIndex(count);
+        internal::SortRange(view.Length(), first, n);
+        return BinarySearchRange(view, item, foundIndex, comparer, first, n);
+    }
+
+private:
+    template<typename V, typename T, typename F, typename Fn>
+    static bool BinarySearchRange(const V& view, const T& item, F& foundIndex, Fn& comparer, int first, int n) {
+        using E = std::remove_const_t<std::remove_pointer_t<decltype(view.Data())>>;
+        const E* b = view.begin() + first;
+        int found = 0;
+        bool result;
+        if constexpr (std::is_invocable_v<Fn&, const E&, const E&>) {
+            result = internal::BinarySearchIn<E>(b, b + n, view.begin(), item, found,
+                [&comparer](const E& a, const E& c) { return static_cast<int>(comparer(a, c)) < 0; });
+        } else {
+            result = internal::BinarySearchIn<E>(b, b + n, view.begin(), item, found,
+                [&comparer](const E& a, const E& c) { return comparer(a) < comparer(c); });
+        }
+        foundIndex = found;
+        return result;
+    }
+};
+
+} // namespace bp
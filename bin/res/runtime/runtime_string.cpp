@@ -17,14 +17,4 @@
 
 namespace bp {
 
-// Thread-local storage for temporary string conversions
-// This allows ToCharPtr() to return a const char* that remains valid during the function call
-thread_local std::string g_tempCharBuffer;
-
-// Convert UTF-16 String to const char* (UTF-8) for C API interop
-const char* String::ToCharPtr() const {
-    g_tempCharBuffer = ToUTF8();
-    return g_tempCharBuffer.c_str();
-}
-
 } // namespace bp
@@ -14,103 +14,142 @@
 #pragma once
 
 #include "runtime_types.h"
+#include "runtime_simd.h"
+#include "runtime_unicode.h"
 #include <algorithm>
 #include <cctype>
+#include <concepts>
+#include <charconv>
 
 namespace bp {
 
+namespace internal {
+
+// Whitespace removed by Trim/TrimLeft/TrimRight
+inline constexpr bool IsTrimChar(CodeUnit c) {
+    return c == u' ' || c == u'\t' || c == u'\n' || c == u'\r';
+}
+
+} // namespace internal
+
 // ============================================================================
 // String Manipulation Functions
 // ============================================================================
 
-inline String Copy(const String& s, int index, int count) {
-    return String(s.GetStdU16String().substr(index - 1, count));
+// Copy returns a view into 's' (no allocation); assigning it to a String
+// materializes it, sharing the buffer when the whole string was copied
+inline StringView Copy(const String& s, int index, int count) {
+    return StringView::Slice(s, index, count);
+}
+
+inline StringView Copy(const String& s, const Integer& index, const Integer& count) {
+    return StringView::Slice(s, index.ToInt(), count.ToInt());
 }
 
-inline String Copy(const String& s, const Integer& index, const Integer& count) {
-    return String(s.GetStdU16String().substr(index.ToInt() - 1, count.ToInt()));
+inline StringView Copy(const StringView& s, int index, int count) {
+    return s.Slice(index, count);
 }
 
+inline StringView Copy(const StringView& s, const Integer& index, const Integer& count) {
+    return s.Slice(index.ToInt(), count.ToInt());
+}
+
+// Delete/Insert edit the string's own buffer (copy-on-write only if shared)
 inline void Delete(String& s, int index, int count) {
-    std::u16string temp = s.GetStdU16String();
-    temp.erase(index - 1, count);
-    s = temp;
+    s.Delete(index, count);
 }
 
 inline void Delete(String& s, const Integer& index, const Integer& count) {
-    std::u16string temp = s.GetStdU16String();
-    temp.erase(index.ToInt() - 1, count.ToInt());
-    s = temp;
+    s.Delete(index.ToInt(), count.ToInt());
 }
 
 inline void Insert(const String& source, String& dest, int index) {
-    std::u16string temp = dest.GetStdU16String();
-    temp.insert(index - 1, source.c_str());
-    dest = temp;
+    dest.Insert(index, source.c_str(), source.Length());
 }
 
 inline void Insert(const String& source, String& dest, const Integer& index) {
-    std::u16string temp = dest.GetStdU16String();
-    temp.insert(index.ToInt() - 1, source.c_str());
-    dest = temp;
+    dest.Insert(index.ToInt(), source.c_str(), source.Length());
 }
 
 inline int Pos(const String& substr, const String& str) {
-    size_t pos = str.GetStdU16String().find(substr.c_str());
-    return (pos == std::u16string::npos) ? 0 : static_cast<int>(pos) + 1;
+    size_t pos = simd::Find(str.c_str(), static_cast<size_t>(str.Length()),
+                            substr.c_str(), static_cast<size_t>(substr.Length()));
+    return (pos == simd::npos) ? 0 : static_cast<int>(pos) + 1;
 }
 
+// UpperCase/LowerCase change ASCII letters only, as in Delphi
 inline String UpperCase(const String& s) {
-    // For ASCII characters only (cross-platform compatible)
-    std::u16string result = s.GetStdU16String();
-    for (char16_t& c : result) {
-        if (c >= u'a' && c <= u'z') {
-            c = c - (u'a' - u'A');
-        }
-    }
-    return String(result);
+    return String::Create(s.Length(), [&](CodeUnit* dst) {
+        simd::ChangeAsciiCase<true>(s.c_str(), static_cast<size_t>(s.Length()), dst);
+    });
 }
 
 inline String LowerCase(const String& s) {
-    // For ASCII characters only (cross-platform compatible)
-    std::u16string result = s.GetStdU16String();
-    for (char16_t& c : result) {
-        if (c >= u'A' && c <= u'Z') {
-            c = c + (u'a' - u'A');
-        }
-    }
-    return String(result);
+    return String::Create(s.Length(), [&](CodeUnit* dst) {
+        simd::ChangeAsciiCase<false>(s.c_str(), static_cast<size_t>(s.Length()), dst);
+    });
 }
 
-inline String Trim(const String& s) {
-    std::u16string str = s.GetStdU16String();
-    size_t start = str.find_first_not_of(u" \t\n\r");
-    size_t end = str.find_last_not_of(u" \t\n\r");
-    
-    if (start == std::u16string::npos)
-        return String(u"");
-    
-    return String(str.substr(start, end - start + 1));
+// AnsiUpperCase/AnsiLowerCase apply the Unicode case mappings of the BMP
+// (runtime_unicode.h). In UTF-8 mode the result can differ in byte length
+inline String AnsiUpperCase(const String& s) {
+    size_t length = static_cast<size_t>(s.Length());
+    return String::Create(static_cast<int>(unicode::ChangeCaseLength<true>(s.c_str(), length)), [&](CodeUnit* dst) {
+        unicode::ChangeCase<true>(s.c_str(), length, dst);
+    });
 }
 
-inline String TrimLeft(const String& s) {
-    std::u16string str = s.GetStdU16String();
-    size_t start = str.find_first_not_of(u" \t\n\r");
-    
-    if (start == std::u16string::npos)
-        return String(u"");
-    
-    return String(str.substr(start));
+inline String AnsiLowerCase(const String& s) {
+    size_t length = static_cast<size_t>(s.Length());
+    return String::Create(static_cast<int>(unicode::ChangeCaseLength<false>(s.c_str(), length)), [&](CodeUnit* dst) {
+        unicode::ChangeCase<false>(s.c_str(), length, dst);
+    });
 }
 
-inline String TrimRight(const String& s) {
-    std::u16string str = s.GetStdU16String();
-    size_t end = str.find_last_not_of(u" \t\n\r");
-    
-    if (end == std::u16string::npos)
-        return String(u"");
-    
-    return String(str.substr(0, end + 1));
+// Trim family returns a view of the untrimmed range (no allocation; the
+// view keeps the source buffer alive)
+namespace internal {
+
+inline int TrimStart(const CodeUnit* p, int len) {
+    int start = 0;
+    while (start < len && IsTrimChar(p[start])) start++;
+    return start;
+}
+
+inline int TrimEnd(const CodeUnit* p, int start, int len) {
+    int end = len;
+    while (end > start && IsTrimChar(p[end - 1])) end--;
+    return end;
+}
+
+} // namespace internal
+
+inline StringView Trim(const StringView& s) {
+    int start = internal::TrimStart(s.Data(), s.Length());
+    return s.Slice(start + 1, internal::TrimEnd(s.Data(), start, s.Length()) - start);
+}
+
+inline StringView TrimLeft(const StringView& s) {
+    int start = internal::TrimStart(s.Data(), s.Length());
+    return s.Slice(start + 1, s.Length() - start);
+}
+
+inline StringView TrimRight(const StringView& s) {
+    return s.Slice(1, internal::TrimEnd(s.Data(), 0, s.Length()));
+}
+
+inline StringView Trim(const String& s) {
+    int start = internal::TrimStart(s.c_str(), s.Length());
+    return StringView::Slice(s, start + 1, internal::TrimEnd(s.c_str(), start, s.Length()) - start);
+}
+
+inline StringView TrimLeft(const String& s) {
+    int start = internal::TrimStart(s.c_str(), s.Length());
+    return StringView::Slice(s, start + 1, s.Length() - start);
+}
+
+inline StringView TrimRight(const String& s) {
+    return StringView::Slice(s, 1, internal::TrimEnd(s.c_str(), 0, s.Length()));
 }
 
 inline String StringOfChar(const Char& c, int count) {
@@ -121,32 +160,101 @@ inline String StringOfChar(const Char& c, const Integer& count) {
     return String(std::u16string(count.ToInt(), c.ToChar16()));
 }
 
-inline String StringReplace(const String& s, const String& oldPattern, const String& newPattern) {
-    if (oldPattern.Length() == 0) {
+// Delphi TReplaceFlags: StringReplace(S, Old, New, [rfReplaceAll, rfIgnoreCase])
+enum TReplaceFlag { rfReplaceAll, rfIgnoreCase };
+using TReplaceFlags = Set<rfReplaceAll, rfIgnoreCase>;
+
+namespace internal {
+
+// Exact, ASCII-folded (vector kernel) or Unicode-folded search; 'matched'
+// receives the length of the match in hay
+enum class MatchCase { Exact, Ascii, Unicode };
+
+inline std::size_t FindPattern(const CodeUnit* hay, std::size_t n, const CodeUnit* pattern, std::size_t m,
+                               MatchCase mode, std::size_t& matched) {
+    matched = m;
+    switch (mode) {
+        case MatchCase::Exact: return simd::Find(hay, n, pattern, m);
+        case MatchCase::Ascii: return simd::FindIgnoreAsciiCase(hay, n, pattern, m);
+        default: return unicode::FindIgnoreCase(hay, n, pattern, m, matched);
+    }
+}
+
+// Replacement engine: counts the matches, sizes the result once, then copies
+// the gaps and replacements in a single pass. No match returns 's' (shared).
+// rfIgnoreCase uses the Unicode simple case folding of AnsiSameText; text
+// that is all ASCII takes the vector ASCII kernel
+inline String ReplacePattern(const String& s, const String& oldPattern, const String& newPattern, bool all, bool ignoreCase) {
+    const CodeUnit* hay = s.c_str();
+    const std::size_t n = static_cast<std::size_t>(s.Length());
+    const CodeUnit* pattern = oldPattern.c_str();
+    const std::size_t m = static_cast<std::size_t>(oldPattern.Length());
+    if (m == 0 || n == 0) {
         return s;  // Empty pattern returns original string
     }
     
-    std::u16string result = s.GetStdU16String();
-    std::u16string oldStr = oldPattern.GetStdU16String();
-    std::u16string newStr = newPattern.GetStdU16String();
+    MatchCase mode = MatchCase::Exact;
+    if (ignoreCase) {
+        mode = unicode::IsAscii(pattern, m) && unicode::IsAscii(hay, n) ? MatchCase::Ascii : MatchCase::Unicode;
+    }
+    if (mode != MatchCase::Unicode && m > n) {
+        return s;
+    }
     
-    size_t pos = 0;
-    while ((pos = result.find(oldStr, pos)) != std::u16string::npos) {
-        result.replace(pos, oldStr.length(), newStr);
-        pos += newStr.length();
+    std::size_t matched;
+    std::size_t first = FindPattern(hay, n, pattern, m, mode, matched);
+    if (first == simd::npos) {
+        return s;
+    }
+    const std::size_t firstLength = matched;
+    std::size_t count = 1;
+    std::size_t removed = matched;
+    if (all) {
+        for (std::size_t pos = first + matched; pos < n; count++) {
+            std::size_t found = FindPattern(hay + pos, n - pos, pattern, m, mode, matched);
+            if (found == simd::npos) break;
+            pos += found + matched;
+            removed += matched;
+        }
     }
     
-    return String(result);
+    const CodeUnit* replacement = newPattern.c_str();
+    const std::size_t r = static_cast<std::size_t>(newPattern.Length());
+    const std::size_t length = n - removed + count * r;
+    return String::Create(static_cast<int>(length), [&](CodeUnit* dst) {
+        std::size_t from = 0;
+        std::size_t at = first;
+        std::size_t len = firstLength;
+        for (std::size_t k = 0; k < count; k++) {
+            if (k > 0) {
+                at = from + FindPattern(hay + from, n - from, pattern, m, mode, len);
+            }
+            std::memcpy(dst, hay + from, (at - from) * sizeof(CodeUnit));
+            dst += at - from;
+            std::memcpy(dst, replacement, r * sizeof(CodeUnit));
+            dst += r;
+            from = at + len;
+        }
+        std::memcpy(dst, hay + from, (n - from) * sizeof(CodeUnit));
+    });
+}
+
+} // namespace internal
+
+// Without flags every occurrence is replaced (case-sensitive)
+inline String StringReplace(const String& s, const String& oldPattern, const String& newPattern) {
+    return internal::ReplacePattern(s, oldPattern, newPattern, true, false);
+}
+
+template<int Low, int High>
+inline String StringReplace(const String& s, const String& oldPattern, const String& newPattern, const Set<Low, High>& flags) {
+    return internal::ReplacePattern(s, oldPattern, newPattern,
+                                    flags.Contains(rfReplaceAll), flags.Contains(rfIgnoreCase));
 }
 
 inline int CompareStr(const String& s1, const String& s2) {
-    std::u16string str1 = s1.GetStdU16String();
-    std::u16string str2 = s2.GetStdU16String();
-    
-    int result = str1.compare(str2);
-    if (result < 0) return -1;
-    if (result > 0) return 1;
-    return 0;
+    return simd::Compare(s1.c_str(), static_cast<size_t>(s1.Length()),
+                         s2.c_str(), static_cast<size_t>(s2.Length()));
 }
 
 inline Integer CompareStr(const String& s1, const String& s2, bool /*dummy*/) {
@@ -154,33 +262,77 @@ inline Integer CompareStr(const String& s1, const String& s2, bool /*dummy*/) {
 }
 
 inline bool SameText(const String& s1, const String& s2) {
-    std::u16string str1 = s1.GetStdU16String();
-    std::u16string str2 = s2.GetStdU16String();
-    
-    if (str1.length() != str2.length()) {
+    // Case-insensitive for ASCII letters only (cross-platform compatible)
+    int len = s1.Length();
+    if (len != s2.Length()) {
         return false;
     }
-    
-    for (size_t i = 0; i < str1.length(); i++) {
-        char16_t c1 = str1[i];
-        char16_t c2 = str2[i];
-        
-        // Convert to uppercase for comparison (ASCII only)
-        if (c1 >= u'a' && c1 <= u'z') c1 = c1 - (u'a' - u'A');
-        if (c2 >= u'a' && c2 <= u'z') c2 = c2 - (u'a' - u'A');
-        
-        if (c1 != c2) {
-            return false;
-        }
-    }
-    
-    return true;
+    return simd::MismatchIgnoreAsciiCase(s1.c_str(), s2.c_str(), static_cast<size_t>(len)) == static_cast<size_t>(len);
 }
 
 inline Boolean SameText(const String& s1, const String& s2, bool /*dummy*/) {
     return Boolean(SameText(s1, s2));
 }
 
+// Case-insensitive for every BMP letter (Unicode case folding, ordinal)
+inline bool AnsiSameText(const String& s1, const String& s2) {
+    return unicode::SameText(s1.c_str(), static_cast<size_t>(s1.Length()),
+                             s2.c_str(), static_cast<size_t>(s2.Length()));
+}
+
+// Overloads taking StringView so slices can be compared and searched without
+// materializing them (chosen only when at least one argument is a view)
+namespace internal {
+
+template<typename T>
+concept StringOrView = std::same_as<T, String> || std::same_as<T, StringView>;
+
+template<typename A, typename B>
+concept HasStringView = StringOrView<A> && StringOrView<B> &&
+                        (std::same_as<A, StringView> || std::same_as<B, StringView>);
+
+// Borrowed for the duration of the call, so no reference is taken
+inline StringView AsView(const String& s) { return StringView(s.c_str(), s.Length()); }
+inline StringView AsView(const StringView& s) { return StringView(s.Data(), s.Length()); }
+
+} // namespace internal
+
+template<typename A, typename B> requires internal::HasStringView<A, B>
+inline int Pos(const A& substr, const B& str) {
+    StringView sub = internal::AsView(substr);
+    StringView hay = internal::AsView(str);
+    size_t pos = simd::Find(hay.Data(), static_cast<size_t>(hay.Length()),
+                            sub.Data(), static_cast<size_t>(sub.Length()));
+    return (pos == simd::npos) ? 0 : static_cast<int>(pos) + 1;
+}
+
+template<typename A, typename B> requires internal::HasStringView<A, B>
+inline int CompareStr(const A& s1, const B& s2) {
+    StringView a = internal::AsView(s1);
+    StringView b = internal::AsView(s2);
+    return simd::Compare(a.Data(), static_cast<size_t>(a.Length()),
+                         b.Data(), static_cast<size_t>(b.Length()));
+}
+
+template<typename A, typename B> requires internal::HasStringView<A, B>
+inline bool SameText(const A& s1, const B& s2) {
+    StringView a = internal::AsView(s1);
+    StringView b = internal::AsView(s2);
+    int len = a.Length();
+    if (len != b.Length()) {
+        return false;
+    }
+    return simd::MismatchIgnoreAsciiCase(a.Data(), b.Data(), static_cast<size_t>(len)) == static_cast<size_t>(len);
+}
+
+template<typename A, typename B> requires internal::HasStringView<A, B>
+inline bool AnsiSameText(const A& s1, const B& s2) {
+    StringView a = internal::AsView(s1);
+    StringView b = internal::AsView(s2);
+    return unicode::SameText(a.Data(), static_cast<size_t>(a.Length()),
+                             b.Data(), static_cast<size_t>(b.Length()));
+}
+
 inline String QuotedStr(const String& s) {
     std::u16string str = s.GetStdU16String();
     std::u16string result = u"'";
@@ -197,6 +349,108 @@ inline String QuotedStr(const String& s) {
     return String(result);
 }
 
+// ============================================================================
+// TStringBuilder - Growable text buffer for loop-built strings
+// A value type (Blaise has no classes): declare it and call its methods, no
+// Create/Free. Appends grow the buffer geometrically and never copy the text
+// built so far; ToString shares the buffer with the result
+// ============================================================================
+class TStringBuilder {
+private:
+    String buffer;
+    
+    TStringBuilder& AppendPiece(const internal::ConcatPiece& piece) {
+        buffer.AppendPieces(&piece, 1);
+        return *this;
+    }
+    
+    template<typename T>
+    TStringBuilder& AppendNumber(T value) {
+        char digits[24];
+        char* end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        return AppendPiece(internal::MakePiece(static_cast<const char*>(digits), static_cast<int>(end - digits)));
+    }
+
+public:
+    TStringBuilder() = default;
+    explicit TStringBuilder(int capacity) { buffer.Reserve(capacity); }
+    explicit TStringBuilder(const String& value) : buffer(value) {}
+    
+    TStringBuilder& Append(const String& value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(const StringView& value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(const wchar_t* value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(const char16_t* value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(const char* value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(wchar_t value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(char16_t value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(const Char& value) { return AppendPiece(internal::MakePiece(value)); }
+    TStringBuilder& Append(int value) { return AppendNumber(value); }
+    TStringBuilder& Append(const Integer& value) { return AppendNumber(value.ToInt()); }
+    TStringBuilder& Append(const Int64& value) { return AppendNumber(value.ToInt64()); }
+    TStringBuilder& Append(const Boolean& value) { return Append(value.ToBool() ? u"True" : u"False"); }
+    
+    // A + B appended without materializing the concatenation first
+    template<std::size_t N>
+    TStringBuilder& Append(const StringConcat<N>& value) {
+        buffer += value;
+        return *this;
+    }
+    
+    TStringBuilder& AppendLine() {
+#ifdef _WIN32
+        return Append(u"\r\n");
+#else
+        return Append(u'\n');
+#endif
+    }
+    
+    template<typename T>
+    TStringBuilder& AppendLine(const T& value) {
+        Append(value);
+        return AppendLine();
+    }
+    
+    // Delphi TStringBuilder.Insert: 'index' is 0-based, clamped to the text
+    TStringBuilder& Insert(int index, const String& value) {
+        buffer.Insert(index + 1, value.c_str(), value.Length());
+        return *this;
+    }
+    
+    TStringBuilder& Insert(const Integer& index, const String& value) {
+        return Insert(index.ToInt(), value);
+    }
+    
+    int Length() const { return buffer.Length(); }
+    int Capacity() const { return buffer.Capacity(); }
+    
+    // Reserve room for 'capacity' characters up front when the size is known
+    int EnsureCapacity(int capacity) {
+        buffer.Reserve(capacity);
+        return buffer.Capacity();
+    }
+    
+    int EnsureCapacity(const Integer& capacity) { return EnsureCapacity(capacity.ToInt()); }
+    
+    // Empties the text but keeps the buffer for reuse
+    TStringBuilder& Clear() {
+        if (buffer.rec && !buffer.rec->IsShared()) {
+            buffer.rec->DropCaches();
+            buffer.rec->length = 0;
+            buffer.rec->Chars()[0] = u'\0';
+        } else {
+            buffer = String();
+        }
+        return *this;
+    }
+    
+    String ToString() const { return buffer; }
+    
+    friend std::ostream& operator<<(std::ostream& os, const TStringBuilder& sb) {
+        os << sb.buffer;
+        return os;
+    }
+};
+
 // ============================================================================
 // Array Helper Functions
 // ============================================================================
@@ -212,6 +466,18 @@ inline void SetLength(Array<T>& arr, const Integer& newlen) {
     arr.SetLength(newlen.ToInt());
 }
 
+// SetLength(A, Rows, Cols, ...) on nested dynamic arrays (array of array of T)
+// sizes every level, as in Delphi; the rows stay separate arrays that can be
+// resized one by one afterwards
+template<typename T, internal::MatrixIndexType N, internal::MatrixIndexType... Rest>
+    requires (sizeof...(Rest) > 0)
+inline void SetLength(Array<Array<T>>& arr, const N& count, const Rest&... rest) {
+    arr.SetLength(internal::MatrixIndex(count));
+    for (Array<T>& item : arr) {
+        SetLength(item, internal::MatrixIndex(rest)...);
+    }
+}
+
 // SetLength - Resize a string
 inline void SetLength(String& s, int newlen) {
     s.SetLength(newlen);
@@ -230,6 +496,14 @@ inline Integer Length(const String& s, bool /*dummy*/) {
     return Integer(s.Length());
 }
 
+inline int Length(const StringView& s) {
+    return s.Length();
+}
+
+inline Integer Length(const StringView& s, bool /*dummy*/) {
+    return Integer(s.Length());
+}
+
 // Length - Get array length
 template<typename T>
 inline int Length(const Array<T>& arr) {
@@ -263,6 +537,58 @@ inline Integer Low(const Array<T>& arr, bool /*dummy*/) {
     return Integer(arr.Low());
 }
 
+// Matrix (TMatrix<T>): SetLength(M, Rows, Cols), Length(M) rows,
+// Length(M[I]) columns
+template<typename T, internal::MatrixIndexType R, internal::MatrixIndexType C>
+inline void SetLength(Matrix<T>& m, const R& rows, const C& cols) {
+    m.SetLength(internal::MatrixIndex(rows), internal::MatrixIndex(cols));
+}
+
+template<typename T>
+inline int Length(const Matrix<T>& m) {
+    return m.Length();
+}
+
+template<typename T>
+inline int High(const Matrix<T>& m) {
+    return m.High();
+}
+
+template<typename T>
+inline int Low(const Matrix<T>& m) {
+    return m.Low();
+}
+
+template<typename T>
+inline int Length(const MatrixRow<T>& row) {
+    return row.Length();
+}
+
+template<typename T>
+inline int High(const MatrixRow<T>& row) {
+    return row.High();
+}
+
+template<typename T>
+inline int Low(const MatrixRow<T>& row) {
+    return row.Low();
+}
+
+template<typename T>
+inline int Length(const OpenArray<T>& arr) {
+    return arr.Length();
+}
+
+template<typename T>
+inline int High(const OpenArray<T>& arr) {
+    return arr.High();
+}
+
+template<typename T>
+inline int Low(const OpenArray<T>& arr) {
+    return arr.Low();
+}
+
 // Low/High - Get bounds for static arrays
 template<typename T, std::size_t N>
 inline int Low(const StaticArray<T, N>& arr) {
@@ -284,7 +610,8 @@ inline Integer High(const StaticArray<T, N>& arr, bool /*dummy*/) {
     return Integer(static_cast<int>(N - 1));
 }
 
-// Copy - Create a copy of array elements
+// Copy - A unique array holding a range of elements (copied as bytes for
+// trivially copyable element types)
 template<typename T>
 inline Array<T> Copy(const Array<T>& arr, int index, int count) {
     // Handle out of bounds gracefully
@@ -306,11 +633,7 @@ inline Array<T> Copy(const Array<T>& arr, int index, int count) {
         actualCount = 0;
     }
     
-    Array<T> result(actualCount);
-    for (int i = 0; i < actualCount; i++) {
-        result[i] = arr[index + i];
-    }
-    return result;
+    return Array<T>(arr.Data() + index, actualCount);
 }
 
 template<typename T>
@@ -318,4 +641,50 @@ inline Array<T> Copy(const Array<T>& arr, const Integer& index, const Integer& c
     return Copy(arr, index.ToInt(), count.ToInt());
 }
 
+// Copy(A) - A unique copy of the whole array (assignment only shares it)
+template<typename T>
+inline Array<T> Copy(const Array<T>& arr) {
+    return Array<T>(arr.Data(), arr.Length());
+}
+
+// Delete/Insert on dynamic arrays (Delphi XE7+): 0-based index, the array
+// is left unique
+template<typename T>
+inline void Delete(Array<T>& arr, int index, int count) {
+    arr.Delete(index, count);
+}
+
+template<typename T>
+inline void Delete(Array<T>& arr, const Integer& index, const Integer& count) {
+    arr.Delete(index.ToInt(), count.ToInt());
+}
+
+template<typename T>
+inline void Insert(const Array<T>& source, Array<T>& dest, int index) {
+    dest.Insert(index, source.Data(), source.Length());
+}
+
+template<typename T>
+inline void Insert(const Array<T>& source, Array<T>& dest, const Integer& index) {
+    dest.Insert(index.ToInt(), source.Data(), source.Length());
+}
+
+// Single element: the value converts to the element type (e.g. a literal into Array<String>)
+template<typename T>
+inline void Insert(const std::type_identity_t<T>& value, Array<T>& dest, int index) {
+    dest.Insert(index, &value, 1);
+}
+
+template<typename T>
+inline void Insert(const std::type_identity_t<T>& value, Array<T>& dest, const Integer& index) {
+    dest.Insert(index.ToInt(), &value, 1);
+}
+
+// Concat - A new array holding the elements of all the arguments
+template<typename T, typename... Rest>
+    requires (std::same_as<Rest, Array<T>> && ...)
+inline Array<T> Concat(const Array<T>& first, const Rest&... rest) {
+    return Array<T>::Join(first, rest...);
+}
+
 } // namespace bp
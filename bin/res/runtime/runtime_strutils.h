@@ -0,0 +1,272 @@
+/*******************************************************************************
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+*******************************************************************************/
+
+// runtime_strutils.h - Native StrUtils routines (ReverseString, DupeString, PadLeft, etc.)
+// res/libs/std/StrUtils.pas declares the Delphi interface as external routines.
+// Every routine that builds a string sizes it once with String::Create
+
+#pragma once
+
+#include "runtime_types.h"
+#include "runtime_string.h"
+#include "runtime_simd.h"
+#include <algorithm>
+#include <cstring>
+
+namespace bp {
+
+// ============================================================================
+// Substrings (views into the source, no allocation)
+// LeftStr, RightStr and MidStr count characters: code units in UTF-16 mode
+// (as in Delphi), code points with BP_STRING_UTF8 so a slice never splits a
+// multi-byte sequence. LeftBStr and RightBStr always count code units, which
+// are bytes in UTF-8 mode
+// ============================================================================
+
+inline StringView LeftBStr(const String& text, int byteCount) {
+    return StringView::Slice(text, 1, byteCount);
+}
+
+inline StringView LeftBStr(const String& text, const Integer& byteCount) {
+    return LeftBStr(text, byteCount.ToInt());
+}
+
+inline StringView RightBStr(const String& text, int byteCount) {
+    int length = text.Length();
+    if (byteCount >= length) {
+        return StringView(text);
+    }
+    return StringView::Slice(text, length - byteCount + 1, byteCount);
+}
+
+inline StringView RightBStr(const String& text, const Integer& byteCount) {
+    return RightBStr(text, byteCount.ToInt());
+}
+
+#if defined(BP_STRING_UTF8)
+
+namespace internal {
+
+// Byte offset 'count' code points after byte offset 'from', clamped to n.
+// An ASCII run is skipped in one step
+inline int SkipCodePoints(const char* s, int n, int from, int count) {
+    if (count <= 0) {
+        return from;
+    }
+    int ascii = static_cast<int>(simd::AsciiPrefixLength(s + from, static_cast<size_t>(std::min(n - from, count))));
+    from += ascii;
+    count -= ascii;
+    while (count > 0 && from < n) {
+        ++from;
+        while (from < n && (static_cast<unsigned char>(s[from]) & 0xC0) == 0x80) {
+            ++from;
+        }
+        --count;
+    }
+    return from;
+}
+
+// Byte offset where the last 'count' code points of s[0..n) start
+inline int SkipCodePointsBack(const char* s, int n, int count) {
+    int from = n;
+    while (count > 0 && from > 0) {
+        --from;
+        while (from > 0 && (static_cast<unsigned char>(s[from]) & 0xC0) == 0x80) {
+            --from;
+        }
+        --count;
+    }
+    return from;
+}
+
+} // namespace internal
+
+inline StringView LeftStr(const String& text, int count) {
+    return StringView::Slice(text, 1, internal::SkipCodePoints(text.c_str(), text.Length(), 0, count));
+}
+
+inline StringView RightStr(const String& text, int count) {
+    int length = text.Length();
+    int from = internal::SkipCodePointsBack(text.c_str(), length, count);
+    return StringView::Slice(text, from + 1, length - from);
+}
+
+inline StringView MidStr(const String& text, int start, int count) {
+    int length = text.Length();
+    int from = internal::SkipCodePoints(text.c_str(), length, 0, start - 1);
+    int to = internal::SkipCodePoints(text.c_str(), length, from, count);
+    return StringView::Slice(text, from + 1, to - from);
+}
+
+#else
+
+inline StringView LeftStr(const String& text, int count) {
+    return LeftBStr(text, count);
+}
+
+inline StringView RightStr(const String& text, int count) {
+    return RightBStr(text, count);
+}
+
+inline StringView MidStr(const String& text, int start, int count) {
+    return StringView::Slice(text, start, count);
+}
+
+#endif
+
+inline StringView LeftStr(const String& text, const Integer& count) {
+    return LeftStr(text, count.ToInt());
+}
+
+inline StringView RightStr(const String& text, const Integer& count) {
+    return RightStr(text, count.ToInt());
+}
+
+inline StringView MidStr(const String& text, const Integer& start, const Integer& count) {
+    return MidStr(text, start.ToInt(), count.ToInt());
+}
+
+// ============================================================================
+// Tests (case-sensitive *Str, ASCII case-insensitive *Text like SameText)
+// ============================================================================
+
+inline Boolean ContainsStr(const String& text, const String& subText) {
+    return Boolean(simd::Find(text.c_str(), static_cast<size_t>(text.Length()),
+                              subText.c_str(), static_cast<size_t>(subText.Length())) != simd::npos);
+}
+
+inline Boolean StartsStr(const String& subText, const String& text) {
+    size_t n = static_cast<size_t>(subText.Length());
+    return Boolean(n <= static_cast<size_t>(text.Length()) &&
+                   simd::Mismatch(text.c_str(), subText.c_str(), n) == n);
+}
+
+inline Boolean EndsStr(const String& subText, const String& text) {
+    size_t n = static_cast<size_t>(subText.Length());
+    size_t length = static_cast<size_t>(text.Length());
+    return Boolean(n <= length && simd::Mismatch(text.c_str() + (length - n), subText.c_str(), n) == n);
+}
+
+inline Boolean ContainsText(const String& text, const String& subText) {
+    return Boolean(simd::FindIgnoreAsciiCase(text.c_str(), static_cast<size_t>(text.Length()),
+                                             subText.c_str(), static_cast<size_t>(subText.Length())) != simd::npos);
+}
+
+inline Boolean StartsText(const String& subText, const String& text) {
+    size_t n = static_cast<size_t>(subText.Length());
+    return Boolean(n <= static_cast<size_t>(text.Length()) &&
+                   simd::MismatchIgnoreAsciiCase(text.c_str(), subText.c_str(), n) == n);
+}
+
+inline Boolean EndsText(const String& subText, const String& text) {
+    size_t n = static_cast<size_t>(subText.Length());
+    size_t length = static_cast<size_t>(text.Length());
+    return Boolean(n <= length && simd::MismatchIgnoreAsciiCase(text.c_str() + (length - n), subText.c_str(), n) == n);
+}
+
+// ============================================================================
+// Builders
+// ============================================================================
+
+// Reverses code units, as Delphi does
+inline String ReverseString(const String& text) {
+    return String::Create(text.Length(), [&](CodeUnit* dst) {
+        simd::Reverse(text.c_str(), static_cast<size_t>(text.Length()), dst);
+    });
+}
+
+// Copies the text once, then doubles the filled prefix (log2(count) memcpy calls).
+// A result longer than MaxInt code units raises EOverflow
+inline String DupeString(const String& text, int count) {
+    int length = text.Length();
+    if (count <= 0 || length == 0) {
+        return String();
+    }
+    if (count == 1) {
+        return text;
+    }
+    int totalLength;
+    if (__builtin_mul_overflow(length, count, &totalLength)) [[unlikely]] {
+        internal::RaiseOverflowError();
+    }
+    size_t total = static_cast<size_t>(totalLength);
+    return String::Create(totalLength, [&](CodeUnit* dst) {
+        std::memcpy(dst, text.c_str(), static_cast<size_t>(length) * sizeof(CodeUnit));
+        size_t filled = static_cast<size_t>(length);
+        while (filled < total) {
+            size_t chunk = std::min(filled, total - filled);
+            std::memcpy(dst + filled, dst, chunk * sizeof(CodeUnit));
+            filled += chunk;
+        }
+    });
+}
+
+inline String DupeString(const String& text, const Integer& count) {
+    return DupeString(text, count.ToInt());
+}
+
+// Copy(Text, 1, Start - 1) + SubText + Copy(Text, Start + Length, MaxInt), built in one allocation
+inline String StuffString(const String& text, int start, int length, const String& subText) {
+    int textLength = text.Length();
+    int head = std::clamp(start - 1, 0, textLength);
+    int tailStart = std::clamp(start + length - 1, 0, textLength);
+    int subLength = subText.Length();
+    int tail = textLength - tailStart;
+    return String::Create(head + subLength + tail, [&](CodeUnit* dst) {
+        std::memcpy(dst, text.c_str(), static_cast<size_t>(head) * sizeof(CodeUnit));
+        std::memcpy(dst + head, subText.c_str(), static_cast<size_t>(subLength) * sizeof(CodeUnit));
+        std::memcpy(dst + head + subLength, text.c_str() + tailStart, static_cast<size_t>(tail) * sizeof(CodeUnit));
+    });
+}
+
+inline String StuffString(const String& text, const Integer& start, const Integer& length, const String& subText) {
+    return StuffString(text, start.ToInt(), length.ToInt(), subText);
+}
+
+inline String ReplaceStr(const String& text, const String& fromText, const String& toText) {
+    return internal::ReplacePattern(text, fromText, toText, true, false);
+}
+
+inline String ReplaceText(const String& text, const String& fromText, const String& toText) {
+    return internal::ReplacePattern(text, fromText, toText, true, true);
+}
+
+inline String PadLeft(const String& text, int width) {
+    int length = text.Length();
+    if (width <= length) {
+        return text;
+    }
+    return String::Create(width, [&](CodeUnit* dst) {
+        std::fill_n(dst, width - length, u' ');
+        std::memcpy(dst + (width - length), text.c_str(), static_cast<size_t>(length) * sizeof(CodeUnit));
+    });
+}
+
+inline String PadLeft(const String& text, const Integer& width) {
+    return PadLeft(text, width.ToInt());
+}
+
+inline String PadRight(const String& text, int width) {
+    int length = text.Length();
+    if (width <= length) {
+        return text;
+    }
+    return String::Create(width, [&](CodeUnit* dst) {
+        std::memcpy(dst, text.c_str(), static_cast<size_t>(length) * sizeof(CodeUnit));
+        std::fill_n(dst + length, width - length, u' ');
+    });
+}
+
+inline String PadRight(const String& text, const Integer& width) {
+    return PadRight(text, width.ToInt());
+}
+
+} // namespace bp
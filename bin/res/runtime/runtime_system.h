@@ -110,43 +110,43 @@ inline String ParamStr(int index) {
 // Inc/Dec as Functions
 // ============================================================================
 
-inline void Inc(Integer& value, const Integer& amount = Integer(1)) {
+BP_NUMERIC_INLINE inline void Inc(Integer& value, const Integer& amount = Integer(1)) {
     value.Inc(amount.ToInt());
 }
 
-inline void Dec(Integer& value, const Integer& amount = Integer(1)) {
+BP_NUMERIC_INLINE inline void Dec(Integer& value, const Integer& amount = Integer(1)) {
     value.Dec(amount.ToInt());
 }
 
-inline void Inc(Int64& value, const Int64& amount = Int64(1)) {
+BP_NUMERIC_INLINE inline void Inc(Int64& value, const Int64& amount = Int64(1)) {
     value.Inc(amount.ToInt64());
 }
 
-inline void Dec(Int64& value, const Int64& amount = Int64(1)) {
+BP_NUMERIC_INLINE inline void Dec(Int64& value, const Int64& amount = Int64(1)) {
     value.Dec(amount.ToInt64());
 }
 
-inline void Inc(Cardinal& value, const Cardinal& amount = Cardinal(1)) {
+BP_NUMERIC_INLINE inline void Inc(Cardinal& value, const Cardinal& amount = Cardinal(1)) {
     value.Inc(amount.ToCardinal());
 }
 
-inline void Dec(Cardinal& value, const Cardinal& amount = Cardinal(1)) {
+BP_NUMERIC_INLINE inline void Dec(Cardinal& value, const Cardinal& amount = Cardinal(1)) {
     value.Dec(amount.ToCardinal());
 }
 
-inline void Inc(Byte& value, int amount = 1) {
+BP_NUMERIC_INLINE inline void Inc(Byte& value, int amount = 1) {
     value.Inc(amount);
 }
 
-inline void Dec(Byte& value, int amount = 1) {
+BP_NUMERIC_INLINE inline void Dec(Byte& value, int amount = 1) {
     value.Dec(amount);
 }
 
-inline void Inc(Word& value, int amount = 1) {
+BP_NUMERIC_INLINE inline void Inc(Word& value, int amount = 1) {
     value.Inc(amount);
 }
 
-inline void Dec(Word& value, int amount = 1) {
+BP_NUMERIC_INLINE inline void Dec(Word& value, int amount = 1) {
     value.Dec(amount);
 }
 
@@ -15,11 +15,45 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <array>
-#include <bitset>
 #include <compare>
+#include <tuple>
+#include <initializer_list>
+#include <utility>
+#include <iterator>
 #include <iostream>
+#include <atomic>
+#include <new>
+#include <memory>
+#include <cstring>
+#include <cwchar>
+#include <algorithm>
+#include <functional>
+#include <filesystem>
+#include <concepts>
+#include <type_traits>
+#include "runtime_simd.h"
+
+// Members of the numeric wrappers (Integer, Int64, Double, ...) and their
+// mixed-type operators. With {$NUMERICS THIN} (BP_THIN_NUMERICS) they are
+// always inlined, even in debug builds, so a + b on two Integers compiles to
+// the same add as on two ints. Otherwise inlining is left to the optimizer.
+// Same-type <, <=, > and >= are spelled out rather than rewritten from <=>,
+// which would go through std::strong_ordering calls at -O0
+#if defined(BP_THIN_NUMERICS) && defined(__GNUC__)
+#define BP_NUMERIC_INLINE [[gnu::always_inline]]
+#else
+#define BP_NUMERIC_INLINE
+#endif
+
+// Out-of-line, rarely taken paths (raising a check failure)
+#if defined(__GNUC__)
+#define BP_COLD [[gnu::cold, gnu::noinline]]
+#else
+#define BP_COLD
+#endif
 
 namespace bp {
 
@@ -27,6 +61,98 @@ namespace bp {
 class Double;
 class Extended;
 
+// ============================================================================
+// Overflow and Range Checks
+// ============================================================================
+// {$OVERFLOWCHECKS ON} (BP_OVERFLOWCHECKS): Integer and Int64 +, -, *, unary
+// minus, div, Inc/Dec and ++/-- raise EOverflow when the result does not fit
+// (mod only needs Low(T) mod -1 kept off the hardware divide).
+// {$RANGECHECKS ON} (BP_RANGECHECKS): Array, StaticArray, open array, Matrix,
+// String and StringView indexing raises ERangeError outside Low..High. Each
+// check is one overflow-flag test or one unsigned compare; the raise is out of
+// line (runtime_exception.cpp).
+// Without the defines the helpers are the plain operation
+
+namespace internal {
+
+[[noreturn]] BP_COLD void RaiseOverflowError();
+[[noreturn]] BP_COLD void RaiseRangeError(long long index, long long low, long long high);
+[[noreturn]] BP_COLD void RaiseCharRangeError(unsigned ch);
+
+template<typename T>
+BP_NUMERIC_INLINE constexpr T CheckedAdd(T a, T b) {
+#if defined(BP_OVERFLOWCHECKS)
+    T r;
+    if (__builtin_add_overflow(a, b, &r)) [[unlikely]] RaiseOverflowError();
+    return r;
+#else
+    return a + b;
+#endif
+}
+
+template<typename T>
+BP_NUMERIC_INLINE constexpr T CheckedSub(T a, T b) {
+#if defined(BP_OVERFLOWCHECKS)
+    T r;
+    if (__builtin_sub_overflow(a, b, &r)) [[unlikely]] RaiseOverflowError();
+    return r;
+#else
+    return a - b;
+#endif
+}
+
+template<typename T>
+BP_NUMERIC_INLINE constexpr T CheckedMul(T a, T b) {
+#if defined(BP_OVERFLOWCHECKS)
+    T r;
+    if (__builtin_mul_overflow(a, b, &r)) [[unlikely]] RaiseOverflowError();
+    return r;
+#else
+    return a * b;
+#endif
+}
+
+template<typename T>
+BP_NUMERIC_INLINE constexpr T CheckedNeg(T a) {
+#if defined(BP_OVERFLOWCHECKS)
+    T r;
+    if (__builtin_sub_overflow(T(0), a, &r)) [[unlikely]] RaiseOverflowError();
+    return r;
+#else
+    return -a;
+#endif
+}
+
+// Only Low(T) div -1 overflows; a zero divisor is left to the hardware as before
+template<typename T>
+BP_NUMERIC_INLINE constexpr T CheckedDiv(T a, T b) {
+#if defined(BP_OVERFLOWCHECKS)
+    if (b == T(-1)) return CheckedNeg(a);
+#endif
+    return a / b;
+}
+
+// x mod -1 is 0, but the hardware divide behind % faults on Low(T) mod -1
+template<typename T>
+BP_NUMERIC_INLINE constexpr T CheckedMod(T a, T b) {
+#if defined(BP_OVERFLOWCHECKS)
+    if (b == T(-1)) return T(0);
+#endif
+    return a % b;
+}
+
+// 0-based index into count elements; a negative index wraps to a huge
+// unsigned value, so one compare covers both ends. 'low' is only reported
+BP_NUMERIC_INLINE constexpr void CheckIndex([[maybe_unused]] int index, [[maybe_unused]] int count,
+                                            [[maybe_unused]] int low = 0) {
+#if defined(BP_RANGECHECKS)
+    if (static_cast<unsigned>(index) >= static_cast<unsigned>(count)) [[unlikely]]
+        RaiseRangeError(static_cast<long long>(index) + low, low, static_cast<long long>(count) - 1 + low);
+#endif
+}
+
+} // namespace internal
+
 // ============================================================================
 // Integer - Wraps int with Pascal semantics
 // ============================================================================
@@ -36,113 +162,117 @@ private:
 
 public:
     // Constructors
-    constexpr Integer() : value(0) {}
-    constexpr Integer(int v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr Integer() : value(0) {}
+    BP_NUMERIC_INLINE constexpr Integer(int v) : value(v) {}
     
     // Assignment
-    Integer& operator=(int v) {
+    BP_NUMERIC_INLINE Integer& operator=(int v) {
         value = v;
         return *this;
     }
     
     // Arithmetic operators
-    Integer operator+(const Integer& other) const {
-        return Integer(value + other.value);
+    BP_NUMERIC_INLINE Integer operator+(const Integer& other) const {
+        return Integer(internal::CheckedAdd(value, other.value));
     }
     
-    Integer operator+(int other) const {
-        return Integer(value + other);
+    BP_NUMERIC_INLINE Integer operator+(int other) const {
+        return Integer(internal::CheckedAdd(value, other));
     }
     
-    Integer operator-(const Integer& other) const {
-        return Integer(value - other.value);
+    BP_NUMERIC_INLINE Integer operator-(const Integer& other) const {
+        return Integer(internal::CheckedSub(value, other.value));
     }
     
-    Integer operator-(int other) const {
-        return Integer(value - other);
+    BP_NUMERIC_INLINE Integer operator-(int other) const {
+        return Integer(internal::CheckedSub(value, other));
     }
     
-    Integer operator*(const Integer& other) const {
-        return Integer(value * other.value);
+    BP_NUMERIC_INLINE Integer operator*(const Integer& other) const {
+        return Integer(internal::CheckedMul(value, other.value));
     }
     
-    Integer operator*(int other) const {
-        return Integer(value * other);
+    BP_NUMERIC_INLINE Integer operator*(int other) const {
+        return Integer(internal::CheckedMul(value, other));
     }
     
-    Double operator*(double other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator*(double other) const;  // Forward declared
     
     // Pascal '/' operator on integers returns Double (Delphi semantic!)
-    Double operator/(const Integer& other) const;  // Forward declared
-    Double operator/(int other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const Integer& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(int other) const;  // Forward declared
     
     // Pascal 'div' operator (integer division)
-    Integer Div(const Integer& other) const {
-        return Integer(value / other.value);
+    BP_NUMERIC_INLINE Integer Div(const Integer& other) const {
+        return Integer(internal::CheckedDiv(value, other.value));
     }
     
     // Pascal 'mod' operator
-    Integer Mod(const Integer& other) const {
-        return Integer(value % other.value);
+    BP_NUMERIC_INLINE Integer Mod(const Integer& other) const {
+        return Integer(internal::CheckedMod(value, other.value));
     }
     
     // Bitwise operators (Pascal: and, or, xor, not, shl, shr with integer operands)
-    Integer operator&(const Integer& other) const {
+    BP_NUMERIC_INLINE Integer operator&(const Integer& other) const {
         return Integer(value & other.value);
     }
     
-    Integer operator|(const Integer& other) const {
+    BP_NUMERIC_INLINE Integer operator|(const Integer& other) const {
         return Integer(value | other.value);
     }
     
-    Integer operator^(const Integer& other) const {
+    BP_NUMERIC_INLINE Integer operator^(const Integer& other) const {
         return Integer(value ^ other.value);
     }
     
-    Integer operator~() const {
+    BP_NUMERIC_INLINE Integer operator~() const {
         return Integer(~value);
     }
     
-    Integer operator<<(int shift) const {
+    BP_NUMERIC_INLINE Integer operator<<(int shift) const {
         return Integer(value << shift);
     }
     
-    Integer operator>>(int shift) const {
+    BP_NUMERIC_INLINE Integer operator>>(int shift) const {
         return Integer(value >> shift);
     }
     
     // Unary minus
-    Integer operator-() const {
-        return Integer(-value);
+    BP_NUMERIC_INLINE Integer operator-() const {
+        return Integer(internal::CheckedNeg(value));
     }
     
     // C++20 spaceship operator - generates all 6 comparison operators!
     auto operator<=>(const Integer& other) const = default;
     bool operator==(const Integer& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Integer& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Integer& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Integer& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Integer& other) const { return value >= other.value; }
     
     // Comparison operators with int
-    bool operator<(int other) const { return value < other; }
-    bool operator<=(int other) const { return value <= other; }
-    bool operator>(int other) const { return value > other; }
-    bool operator>=(int other) const { return value >= other; }
-    bool operator==(int other) const { return value == other; }
-    bool operator!=(int other) const { return value != other; }
+    BP_NUMERIC_INLINE bool operator<(int other) const { return value < other; }
+    BP_NUMERIC_INLINE bool operator<=(int other) const { return value <= other; }
+    BP_NUMERIC_INLINE bool operator>(int other) const { return value > other; }
+    BP_NUMERIC_INLINE bool operator>=(int other) const { return value >= other; }
+    BP_NUMERIC_INLINE bool operator==(int other) const { return value == other; }
+    BP_NUMERIC_INLINE bool operator!=(int other) const { return value != other; }
     
     // Inc/Dec (Pascal intrinsics)
-    void Inc(int amount = 1) { value += amount; }
-    void Dec(int amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(int amount = 1) { value = internal::CheckedAdd(value, amount); }
+    BP_NUMERIC_INLINE void Dec(int amount = 1) { value = internal::CheckedSub(value, amount); }
     
     // Prefix increment/decrement for C++ for-loops
-    Integer& operator++() { ++value; return *this; }
-    Integer& operator--() { --value; return *this; }
+    BP_NUMERIC_INLINE Integer& operator++() { value = internal::CheckedAdd(value, 1); return *this; }
+    BP_NUMERIC_INLINE Integer& operator--() { value = internal::CheckedSub(value, 1); return *this; }
     
     // Postfix increment/decrement
-    Integer operator++(int) { Integer temp = *this; ++value; return temp; }
-    Integer operator--(int) { Integer temp = *this; --value; return temp; }
+    BP_NUMERIC_INLINE Integer operator++(int) { Integer temp = *this; ++*this; return temp; }
+    BP_NUMERIC_INLINE Integer operator--(int) { Integer temp = *this; --*this; return temp; }
     
     // Conversion
-    int ToInt() const { return value; }
-    explicit operator int() const { return value; }  // Explicit conversion to prevent ambiguity
+    BP_NUMERIC_INLINE int ToInt() const { return value; }
+    BP_NUMERIC_INLINE explicit operator int() const { return value; }  // Explicit conversion to prevent ambiguity
     
     // For I/O
     friend std::ostream& operator<<(std::ostream& os, const Integer& i) {
@@ -162,81 +292,85 @@ private:
     long long value;
 
 public:
-    constexpr Int64() : value(0) {}
-    constexpr Int64(long long v) : value(v) {}
-    constexpr Int64(const Integer& i) : value(static_cast<long long>(i.ToInt())) {}
-    constexpr Int64(int i) : value(static_cast<long long>(i)) {}
+    BP_NUMERIC_INLINE constexpr Int64() : value(0) {}
+    BP_NUMERIC_INLINE constexpr Int64(long long v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr Int64(const Integer& i) : value(static_cast<long long>(i.ToInt())) {}
+    BP_NUMERIC_INLINE constexpr Int64(int i) : value(static_cast<long long>(i)) {}
     
-    Int64& operator=(long long v) {
+    BP_NUMERIC_INLINE Int64& operator=(long long v) {
         value = v;
         return *this;
     }
     
-    Int64& operator=(const Integer& i) {
+    BP_NUMERIC_INLINE Int64& operator=(const Integer& i) {
         value = static_cast<long long>(i.ToInt());
         return *this;
     }
     
-    Int64& operator=(int i) {
+    BP_NUMERIC_INLINE Int64& operator=(int i) {
         value = static_cast<long long>(i);
         return *this;
     }
     
-    Int64 operator+(const Int64& other) const {
-        return Int64(value + other.value);
+    BP_NUMERIC_INLINE Int64 operator+(const Int64& other) const {
+        return Int64(internal::CheckedAdd(value, other.value));
     }
     
-    Int64 operator+(int other) const {
-        return Int64(value + other);
+    BP_NUMERIC_INLINE Int64 operator+(int other) const {
+        return Int64(internal::CheckedAdd<long long>(value, other));
     }
     
-    Int64 operator+(long long other) const {
-        return Int64(value + other);
+    BP_NUMERIC_INLINE Int64 operator+(long long other) const {
+        return Int64(internal::CheckedAdd<long long>(value, other));
     }
     
-    Int64 operator-(const Int64& other) const {
-        return Int64(value - other.value);
+    BP_NUMERIC_INLINE Int64 operator-(const Int64& other) const {
+        return Int64(internal::CheckedSub(value, other.value));
     }
     
-    Int64 operator*(const Int64& other) const {
-        return Int64(value * other.value);
+    BP_NUMERIC_INLINE Int64 operator*(const Int64& other) const {
+        return Int64(internal::CheckedMul(value, other.value));
     }
     
-    Int64 operator*(int other) const {
-        return Int64(value * other);
+    BP_NUMERIC_INLINE Int64 operator*(int other) const {
+        return Int64(internal::CheckedMul<long long>(value, other));
     }
     
-    Int64 operator*(long long other) const {
-        return Int64(value * other);
+    BP_NUMERIC_INLINE Int64 operator*(long long other) const {
+        return Int64(internal::CheckedMul<long long>(value, other));
     }
     
-    Double operator*(double other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator*(double other) const;  // Forward declared
     
-    Double operator/(const Int64& other) const;  // Forward declared
-    Double operator/(int other) const;  // Forward declared
-    Double operator/(long long other) const;  // Forward declared
-    Double operator/(double other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const Int64& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(int other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(long long other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(double other) const;  // Forward declared
     
-    Int64 Div(const Int64& other) const {
-        return Int64(value / other.value);
+    BP_NUMERIC_INLINE Int64 Div(const Int64& other) const {
+        return Int64(internal::CheckedDiv(value, other.value));
     }
     
-    Int64 Mod(const Int64& other) const {
-        return Int64(value % other.value);
+    BP_NUMERIC_INLINE Int64 Mod(const Int64& other) const {
+        return Int64(internal::CheckedMod(value, other.value));
     }
     
-    Int64 operator-() const {
-        return Int64(-value);
+    BP_NUMERIC_INLINE Int64 operator-() const {
+        return Int64(internal::CheckedNeg(value));
     }
     
     auto operator<=>(const Int64& other) const = default;
     bool operator==(const Int64& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Int64& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Int64& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Int64& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Int64& other) const { return value >= other.value; }
     
-    void Inc(long long amount = 1) { value += amount; }
-    void Dec(long long amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(long long amount = 1) { value = internal::CheckedAdd(value, amount); }
+    BP_NUMERIC_INLINE void Dec(long long amount = 1) { value = internal::CheckedSub(value, amount); }
     
-    long long ToInt64() const { return value; }
-    explicit operator long long() const { return value; }
+    BP_NUMERIC_INLINE long long ToInt64() const { return value; }
+    BP_NUMERIC_INLINE explicit operator long long() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Int64& i) {
         return os << i.value;
@@ -255,76 +389,80 @@ private:
     unsigned long long value;
 
 public:
-    constexpr UInt64() : value(0) {}
-    constexpr UInt64(unsigned long long v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr UInt64() : value(0) {}
+    BP_NUMERIC_INLINE constexpr UInt64(unsigned long long v) : value(v) {}
     
-    UInt64& operator=(unsigned long long v) {
+    BP_NUMERIC_INLINE UInt64& operator=(unsigned long long v) {
         value = v;
         return *this;
     }
     
-    UInt64 operator+(const UInt64& other) const {
+    BP_NUMERIC_INLINE UInt64 operator+(const UInt64& other) const {
         return UInt64(value + other.value);
     }
     
-    UInt64 operator+(int other) const {
+    BP_NUMERIC_INLINE UInt64 operator+(int other) const {
         return UInt64(value + other);
     }
     
-    UInt64 operator+(const Integer& other) const {
+    BP_NUMERIC_INLINE UInt64 operator+(const Integer& other) const {
         return UInt64(value + other.ToInt());
     }
     
-    UInt64 operator-(const UInt64& other) const {
+    BP_NUMERIC_INLINE UInt64 operator-(const UInt64& other) const {
         return UInt64(value - other.value);
     }
     
-    UInt64 operator-(int other) const {
+    BP_NUMERIC_INLINE UInt64 operator-(int other) const {
         return UInt64(value - other);
     }
     
-    UInt64 operator-(const Integer& other) const {
+    BP_NUMERIC_INLINE UInt64 operator-(const Integer& other) const {
         return UInt64(value - other.ToInt());
     }
     
-    UInt64 operator*(const UInt64& other) const {
+    BP_NUMERIC_INLINE UInt64 operator*(const UInt64& other) const {
         return UInt64(value * other.value);
     }
     
-    UInt64 operator*(int other) const {
+    BP_NUMERIC_INLINE UInt64 operator*(int other) const {
         return UInt64(value * other);
     }
     
-    UInt64 operator*(const Integer& other) const {
+    BP_NUMERIC_INLINE UInt64 operator*(const Integer& other) const {
         return UInt64(value * other.ToInt());
     }
     
-    Double operator/(const UInt64& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const UInt64& other) const;  // Forward declared
     
-    UInt64 Div(const UInt64& other) const {
+    BP_NUMERIC_INLINE UInt64 Div(const UInt64& other) const {
         return UInt64(value / other.value);
     }
     
-    UInt64 Mod(const UInt64& other) const {
+    BP_NUMERIC_INLINE UInt64 Mod(const UInt64& other) const {
         return UInt64(value % other.value);
     }
     
     auto operator<=>(const UInt64& other) const = default;
     bool operator==(const UInt64& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const UInt64& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const UInt64& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const UInt64& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const UInt64& other) const { return value >= other.value; }
     
     // Comparison operators with int
-    bool operator<(int other) const { return value < static_cast<unsigned long long>(other); }
-    bool operator<=(int other) const { return value <= static_cast<unsigned long long>(other); }
-    bool operator>(int other) const { return value > static_cast<unsigned long long>(other); }
-    bool operator>=(int other) const { return value >= static_cast<unsigned long long>(other); }
-    bool operator==(int other) const { return value == static_cast<unsigned long long>(other); }
-    bool operator!=(int other) const { return value != static_cast<unsigned long long>(other); }
+    BP_NUMERIC_INLINE bool operator<(int other) const { return value < static_cast<unsigned long long>(other); }
+    BP_NUMERIC_INLINE bool operator<=(int other) const { return value <= static_cast<unsigned long long>(other); }
+    BP_NUMERIC_INLINE bool operator>(int other) const { return value > static_cast<unsigned long long>(other); }
+    BP_NUMERIC_INLINE bool operator>=(int other) const { return value >= static_cast<unsigned long long>(other); }
+    BP_NUMERIC_INLINE bool operator==(int other) const { return value == static_cast<unsigned long long>(other); }
+    BP_NUMERIC_INLINE bool operator!=(int other) const { return value != static_cast<unsigned long long>(other); }
     
-    void Inc(unsigned long long amount = 1) { value += amount; }
-    void Dec(unsigned long long amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(unsigned long long amount = 1) { value += amount; }
+    BP_NUMERIC_INLINE void Dec(unsigned long long amount = 1) { value -= amount; }
     
-    unsigned long long ToUInt64() const { return value; }
-    explicit operator unsigned long long() const { return value; }
+    BP_NUMERIC_INLINE unsigned long long ToUInt64() const { return value; }
+    BP_NUMERIC_INLINE explicit operator unsigned long long() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const UInt64& u) {
         return os << u.value;
@@ -343,44 +481,48 @@ private:
     unsigned int value;
 
 public:
-    constexpr Cardinal() : value(0) {}
-    constexpr Cardinal(unsigned int v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr Cardinal() : value(0) {}
+    BP_NUMERIC_INLINE constexpr Cardinal(unsigned int v) : value(v) {}
     
-    Cardinal& operator=(unsigned int v) {
+    BP_NUMERIC_INLINE Cardinal& operator=(unsigned int v) {
         value = v;
         return *this;
     }
     
-    Cardinal operator+(const Cardinal& other) const {
+    BP_NUMERIC_INLINE Cardinal operator+(const Cardinal& other) const {
         return Cardinal(value + other.value);
     }
     
-    Cardinal operator-(const Cardinal& other) const {
+    BP_NUMERIC_INLINE Cardinal operator-(const Cardinal& other) const {
         return Cardinal(value - other.value);
     }
     
-    Cardinal operator*(const Cardinal& other) const {
+    BP_NUMERIC_INLINE Cardinal operator*(const Cardinal& other) const {
         return Cardinal(value * other.value);
     }
     
-    Double operator/(const Cardinal& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const Cardinal& other) const;  // Forward declared
     
-    Cardinal Div(const Cardinal& other) const {
+    BP_NUMERIC_INLINE Cardinal Div(const Cardinal& other) const {
         return Cardinal(value / other.value);
     }
     
-    Cardinal Mod(const Cardinal& other) const {
+    BP_NUMERIC_INLINE Cardinal Mod(const Cardinal& other) const {
         return Cardinal(value % other.value);
     }
     
     auto operator<=>(const Cardinal& other) const = default;
     bool operator==(const Cardinal& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Cardinal& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Cardinal& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Cardinal& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Cardinal& other) const { return value >= other.value; }
     
-    void Inc(unsigned int amount = 1) { value += amount; }
-    void Dec(unsigned int amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(unsigned int amount = 1) { value += amount; }
+    BP_NUMERIC_INLINE void Dec(unsigned int amount = 1) { value -= amount; }
     
-    unsigned int ToCardinal() const { return value; }
-    explicit operator unsigned int() const { return value; }
+    BP_NUMERIC_INLINE unsigned int ToCardinal() const { return value; }
+    BP_NUMERIC_INLINE explicit operator unsigned int() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Cardinal& c) {
         return os << c.value;
@@ -399,46 +541,50 @@ private:
     unsigned char value;
 
 public:
-    constexpr Byte() : value(0) {}
-    constexpr Byte(unsigned char v) : value(v) {}
-    constexpr Byte(int v) : value(static_cast<unsigned char>(v)) {}
+    BP_NUMERIC_INLINE constexpr Byte() : value(0) {}
+    BP_NUMERIC_INLINE constexpr Byte(unsigned char v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr Byte(int v) : value(static_cast<unsigned char>(v)) {}
     
-    Byte& operator=(unsigned char v) {
+    BP_NUMERIC_INLINE Byte& operator=(unsigned char v) {
         value = v;
         return *this;
     }
     
-    Byte operator+(const Byte& other) const {
+    BP_NUMERIC_INLINE Byte operator+(const Byte& other) const {
         return Byte(value + other.value);
     }
     
-    Byte operator-(const Byte& other) const {
+    BP_NUMERIC_INLINE Byte operator-(const Byte& other) const {
         return Byte(value - other.value);
     }
     
-    Byte operator*(const Byte& other) const {
+    BP_NUMERIC_INLINE Byte operator*(const Byte& other) const {
         return Byte(value * other.value);
     }
     
-    Double operator/(const Byte& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const Byte& other) const;  // Forward declared
     
-    Byte Div(const Byte& other) const {
+    BP_NUMERIC_INLINE Byte Div(const Byte& other) const {
         return Byte(value / other.value);
     }
     
-    Byte Mod(const Byte& other) const {
+    BP_NUMERIC_INLINE Byte Mod(const Byte& other) const {
         return Byte(value % other.value);
     }
     
     auto operator<=>(const Byte& other) const = default;
     bool operator==(const Byte& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Byte& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Byte& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Byte& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Byte& other) const { return value >= other.value; }
     
-    void Inc(int amount = 1) { value += amount; }
-    void Dec(int amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(int amount = 1) { value += amount; }
+    BP_NUMERIC_INLINE void Dec(int amount = 1) { value -= amount; }
     
-    unsigned char ToByte() const { return value; }
-    int ToInt() const { return static_cast<int>(value); }
-    explicit operator unsigned char() const { return value; }
+    BP_NUMERIC_INLINE unsigned char ToByte() const { return value; }
+    BP_NUMERIC_INLINE int ToInt() const { return static_cast<int>(value); }
+    BP_NUMERIC_INLINE explicit operator unsigned char() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Byte& b) {
         return os << static_cast<int>(b.value);
@@ -460,46 +606,50 @@ private:
     unsigned short value;
 
 public:
-    constexpr Word() : value(0) {}
-    constexpr Word(unsigned short v) : value(v) {}
-    constexpr Word(int v) : value(static_cast<unsigned short>(v)) {}
+    BP_NUMERIC_INLINE constexpr Word() : value(0) {}
+    BP_NUMERIC_INLINE constexpr Word(unsigned short v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr Word(int v) : value(static_cast<unsigned short>(v)) {}
     
-    Word& operator=(unsigned short v) {
+    BP_NUMERIC_INLINE Word& operator=(unsigned short v) {
         value = v;
         return *this;
     }
     
-    Word operator+(const Word& other) const {
+    BP_NUMERIC_INLINE Word operator+(const Word& other) const {
         return Word(value + other.value);
     }
     
-    Word operator-(const Word& other) const {
+    BP_NUMERIC_INLINE Word operator-(const Word& other) const {
         return Word(value - other.value);
     }
     
-    Word operator*(const Word& other) const {
+    BP_NUMERIC_INLINE Word operator*(const Word& other) const {
         return Word(value * other.value);
     }
     
-    Double operator/(const Word& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const Word& other) const;  // Forward declared
     
-    Word Div(const Word& other) const {
+    BP_NUMERIC_INLINE Word Div(const Word& other) const {
         return Word(value / other.value);
     }
     
-    Word Mod(const Word& other) const {
+    BP_NUMERIC_INLINE Word Mod(const Word& other) const {
         return Word(value % other.value);
     }
     
     auto operator<=>(const Word& other) const = default;
     bool operator==(const Word& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Word& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Word& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Word& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Word& other) const { return value >= other.value; }
     
-    void Inc(int amount = 1) { value += amount; }
-    void Dec(int amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(int amount = 1) { value += amount; }
+    BP_NUMERIC_INLINE void Dec(int amount = 1) { value -= amount; }
     
-    unsigned short ToWord() const { return value; }
-    int ToInt() const { return static_cast<int>(value); }
-    explicit operator unsigned short() const { return value; }
+    BP_NUMERIC_INLINE unsigned short ToWord() const { return value; }
+    BP_NUMERIC_INLINE int ToInt() const { return static_cast<int>(value); }
+    BP_NUMERIC_INLINE explicit operator unsigned short() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Word& w) {
         return os << w.value;
@@ -518,50 +668,54 @@ private:
     signed char value;
 
 public:
-    constexpr ShortInt() : value(0) {}
-    constexpr ShortInt(signed char v) : value(v) {}
-    constexpr ShortInt(int v) : value(static_cast<signed char>(v)) {}
+    BP_NUMERIC_INLINE constexpr ShortInt() : value(0) {}
+    BP_NUMERIC_INLINE constexpr ShortInt(signed char v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr ShortInt(int v) : value(static_cast<signed char>(v)) {}
     
-    ShortInt& operator=(signed char v) {
+    BP_NUMERIC_INLINE ShortInt& operator=(signed char v) {
         value = v;
         return *this;
     }
     
-    ShortInt operator+(const ShortInt& other) const {
+    BP_NUMERIC_INLINE ShortInt operator+(const ShortInt& other) const {
         return ShortInt(value + other.value);
     }
     
-    ShortInt operator-(const ShortInt& other) const {
+    BP_NUMERIC_INLINE ShortInt operator-(const ShortInt& other) const {
         return ShortInt(value - other.value);
     }
     
-    ShortInt operator*(const ShortInt& other) const {
+    BP_NUMERIC_INLINE ShortInt operator*(const ShortInt& other) const {
         return ShortInt(value * other.value);
     }
     
-    Double operator/(const ShortInt& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const ShortInt& other) const;  // Forward declared
     
-    ShortInt Div(const ShortInt& other) const {
+    BP_NUMERIC_INLINE ShortInt Div(const ShortInt& other) const {
         return ShortInt(value / other.value);
     }
     
-    ShortInt Mod(const ShortInt& other) const {
+    BP_NUMERIC_INLINE ShortInt Mod(const ShortInt& other) const {
         return ShortInt(value % other.value);
     }
     
-    ShortInt operator-() const {
+    BP_NUMERIC_INLINE ShortInt operator-() const {
         return ShortInt(-value);
     }
     
     auto operator<=>(const ShortInt& other) const = default;
     bool operator==(const ShortInt& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const ShortInt& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const ShortInt& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const ShortInt& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const ShortInt& other) const { return value >= other.value; }
     
-    void Inc(int amount = 1) { value += amount; }
-    void Dec(int amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(int amount = 1) { value += amount; }
+    BP_NUMERIC_INLINE void Dec(int amount = 1) { value -= amount; }
     
-    signed char ToShortInt() const { return value; }
-    int ToInt() const { return static_cast<int>(value); }
-    explicit operator signed char() const { return value; }
+    BP_NUMERIC_INLINE signed char ToShortInt() const { return value; }
+    BP_NUMERIC_INLINE int ToInt() const { return static_cast<int>(value); }
+    BP_NUMERIC_INLINE explicit operator signed char() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const ShortInt& s) {
         return os << static_cast<int>(s.value);
@@ -583,50 +737,54 @@ private:
     short value;
 
 public:
-    constexpr SmallInt() : value(0) {}
-    constexpr SmallInt(short v) : value(v) {}
-    constexpr SmallInt(int v) : value(static_cast<short>(v)) {}
+    BP_NUMERIC_INLINE constexpr SmallInt() : value(0) {}
+    BP_NUMERIC_INLINE constexpr SmallInt(short v) : value(v) {}
+    BP_NUMERIC_INLINE constexpr SmallInt(int v) : value(static_cast<short>(v)) {}
     
-    SmallInt& operator=(short v) {
+    BP_NUMERIC_INLINE SmallInt& operator=(short v) {
         value = v;
         return *this;
     }
     
-    SmallInt operator+(const SmallInt& other) const {
+    BP_NUMERIC_INLINE SmallInt operator+(const SmallInt& other) const {
         return SmallInt(value + other.value);
     }
     
-    SmallInt operator-(const SmallInt& other) const {
+    BP_NUMERIC_INLINE SmallInt operator-(const SmallInt& other) const {
         return SmallInt(value - other.value);
     }
     
-    SmallInt operator*(const SmallInt& other) const {
+    BP_NUMERIC_INLINE SmallInt operator*(const SmallInt& other) const {
         return SmallInt(value * other.value);
     }
     
-    Double operator/(const SmallInt& other) const;  // Forward declared
+    BP_NUMERIC_INLINE Double operator/(const SmallInt& other) const;  // Forward declared
     
-    SmallInt Div(const SmallInt& other) const {
+    BP_NUMERIC_INLINE SmallInt Div(const SmallInt& other) const {
         return SmallInt(value / other.value);
     }
     
-    SmallInt Mod(const SmallInt& other) const {
+    BP_NUMERIC_INLINE SmallInt Mod(const SmallInt& other) const {
         return SmallInt(value % other.value);
     }
     
-    SmallInt operator-() const {
+    BP_NUMERIC_INLINE SmallInt operator-() const {
         return SmallInt(-value);
     }
     
     auto operator<=>(const SmallInt& other) const = default;
     bool operator==(const SmallInt& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const SmallInt& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const SmallInt& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const SmallInt& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const SmallInt& other) const { return value >= other.value; }
     
-    void Inc(int amount = 1) { value += amount; }
-    void Dec(int amount = 1) { value -= amount; }
+    BP_NUMERIC_INLINE void Inc(int amount = 1) { value += amount; }
+    BP_NUMERIC_INLINE void Dec(int amount = 1) { value -= amount; }
     
-    short ToSmallInt() const { return value; }
-    int ToInt() const { return static_cast<int>(value); }
-    explicit operator short() const { return value; }
+    BP_NUMERIC_INLINE short ToSmallInt() const { return value; }
+    BP_NUMERIC_INLINE int ToInt() const { return static_cast<int>(value); }
+    BP_NUMERIC_INLINE explicit operator short() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const SmallInt& s) {
         return os << s.value;
@@ -820,40 +978,44 @@ private:
     float value;
 
 public:
-    Single() : value(0.0f) {}
-    Single(float v) : value(v) {}
-    Single(int v) : value(static_cast<float>(v)) {}
+    BP_NUMERIC_INLINE Single() : value(0.0f) {}
+    BP_NUMERIC_INLINE Single(float v) : value(v) {}
+    BP_NUMERIC_INLINE Single(int v) : value(static_cast<float>(v)) {}
     
-    Single& operator=(float v) {
+    BP_NUMERIC_INLINE Single& operator=(float v) {
         value = v;
         return *this;
     }
     
-    Single operator+(const Single& other) const {
+    BP_NUMERIC_INLINE Single operator+(const Single& other) const {
         return Single(value + other.value);
     }
     
-    Single operator-(const Single& other) const {
+    BP_NUMERIC_INLINE Single operator-(const Single& other) const {
         return Single(value - other.value);
     }
     
-    Single operator*(const Single& other) const {
+    BP_NUMERIC_INLINE Single operator*(const Single& other) const {
         return Single(value * other.value);
     }
     
-    Single operator/(const Single& other) const {
+    BP_NUMERIC_INLINE Single operator/(const Single& other) const {
         return Single(value / other.value);
     }
     
-    Single operator-() const {
+    BP_NUMERIC_INLINE Single operator-() const {
         return Single(-value);
     }
     
     auto operator<=>(const Single& other) const = default;
     bool operator==(const Single& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Single& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Single& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Single& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Single& other) const { return value >= other.value; }
     
-    float ToFloat() const { return value; }
-    explicit operator float() const { return value; }
+    BP_NUMERIC_INLINE float ToFloat() const { return value; }
+    BP_NUMERIC_INLINE explicit operator float() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Single& s) {
         return os << s.value;
@@ -872,96 +1034,100 @@ private:
     double value;
 
 public:
-    Double() : value(0.0) {}
-    Double(double v) : value(v) {}
-    Double(int v) : value(static_cast<double>(v)) {}
-    Double(float v) : value(static_cast<double>(v)) {}
-    Double(long long v) : value(static_cast<double>(v)) {}
-    Double(const Integer& i) : value(static_cast<double>(i.ToInt())) {}
-    Double(const Int64& i) : value(static_cast<double>(i.ToInt64())) {}
-    
-    Double& operator=(double v) {
+    BP_NUMERIC_INLINE Double() : value(0.0) {}
+    BP_NUMERIC_INLINE Double(double v) : value(v) {}
+    BP_NUMERIC_INLINE Double(int v) : value(static_cast<double>(v)) {}
+    BP_NUMERIC_INLINE Double(float v) : value(static_cast<double>(v)) {}
+    BP_NUMERIC_INLINE Double(long long v) : value(static_cast<double>(v)) {}
+    BP_NUMERIC_INLINE Double(const Integer& i) : value(static_cast<double>(i.ToInt())) {}
+    BP_NUMERIC_INLINE Double(const Int64& i) : value(static_cast<double>(i.ToInt64())) {}
+    
+    BP_NUMERIC_INLINE Double& operator=(double v) {
         value = v;
         return *this;
     }
     
-    Double& operator=(int v) {
+    BP_NUMERIC_INLINE Double& operator=(int v) {
         value = static_cast<double>(v);
         return *this;
     }
     
-    Double& operator=(long long v) {
+    BP_NUMERIC_INLINE Double& operator=(long long v) {
         value = static_cast<double>(v);
         return *this;
     }
     
-    Double& operator=(const Integer& i) {
+    BP_NUMERIC_INLINE Double& operator=(const Integer& i) {
         value = static_cast<double>(i.ToInt());
         return *this;
     }
     
-    Double& operator=(const Int64& i) {
+    BP_NUMERIC_INLINE Double& operator=(const Int64& i) {
         value = static_cast<double>(i.ToInt64());
         return *this;
     }
     
-    Double operator+(const Double& other) const {
+    BP_NUMERIC_INLINE Double operator+(const Double& other) const {
         return Double(value + other.value);
     }
     
-    Double operator+(int other) const {
+    BP_NUMERIC_INLINE Double operator+(int other) const {
         return Double(value + static_cast<double>(other));
     }
     
-    Double operator+(double other) const {
+    BP_NUMERIC_INLINE Double operator+(double other) const {
         return Double(value + other);
     }
     
-    Double operator-(const Double& other) const {
+    BP_NUMERIC_INLINE Double operator-(const Double& other) const {
         return Double(value - other.value);
     }
     
-    Double operator-(int other) const {
+    BP_NUMERIC_INLINE Double operator-(int other) const {
         return Double(value - static_cast<double>(other));
     }
     
-    Double operator-(double other) const {
+    BP_NUMERIC_INLINE Double operator-(double other) const {
         return Double(value - other);
     }
     
-    Double operator*(const Double& other) const {
+    BP_NUMERIC_INLINE Double operator*(const Double& other) const {
         return Double(value * other.value);
     }
     
-    Double operator*(int other) const {
+    BP_NUMERIC_INLINE Double operator*(int other) const {
         return Double(value * static_cast<double>(other));
     }
     
-    Double operator*(double other) const {
+    BP_NUMERIC_INLINE Double operator*(double other) const {
         return Double(value * other);
     }
     
-    Double operator/(const Double& other) const {
+    BP_NUMERIC_INLINE Double operator/(const Double& other) const {
         return Double(value / other.value);
     }
     
-    Double operator/(int other) const {
+    BP_NUMERIC_INLINE Double operator/(int other) const {
         return Double(value / static_cast<double>(other));
     }
     
-    Double operator/(double other) const {
+    BP_NUMERIC_INLINE Double operator/(double other) const {
         return Double(value / other);
     }
     
-    Double operator-() const {
+    BP_NUMERIC_INLINE Double operator-() const {
         return Double(-value);
     }
     
     auto operator<=>(const Double& other) const = default;
     bool operator==(const Double& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Double& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Double& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Double& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Double& other) const { return value >= other.value; }
     
-    double ToDouble() const { return value; }
-    explicit operator double() const { return value; }
+    BP_NUMERIC_INLINE double ToDouble() const { return value; }
+    BP_NUMERIC_INLINE explicit operator double() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Double& d) {
         return os << d.value;
@@ -973,59 +1139,59 @@ public:
 };
 
 // Now define Integer::operator/ (returns Double)
-inline Double Integer::operator/(const Integer& other) const {
+BP_NUMERIC_INLINE inline Double Integer::operator/(const Integer& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double Integer::operator/(int other) const {
+BP_NUMERIC_INLINE inline Double Integer::operator/(int other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other));
 }
 
-inline Double Integer::operator*(double other) const {
+BP_NUMERIC_INLINE inline Double Integer::operator*(double other) const {
     return Double(static_cast<double>(value) * other);
 }
 
-inline Double Int64::operator/(const Int64& other) const {
+BP_NUMERIC_INLINE inline Double Int64::operator/(const Int64& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double Int64::operator/(int other) const {
+BP_NUMERIC_INLINE inline Double Int64::operator/(int other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other));
 }
 
-inline Double Int64::operator/(long long other) const {
+BP_NUMERIC_INLINE inline Double Int64::operator/(long long other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other));
 }
 
-inline Double Int64::operator/(double other) const {
+BP_NUMERIC_INLINE inline Double Int64::operator/(double other) const {
     return Double(static_cast<double>(value) / other);
 }
 
-inline Double Int64::operator*(double other) const {
+BP_NUMERIC_INLINE inline Double Int64::operator*(double other) const {
     return Double(static_cast<double>(value) * other);
 }
 
-inline Double Cardinal::operator/(const Cardinal& other) const {
+BP_NUMERIC_INLINE inline Double Cardinal::operator/(const Cardinal& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double Byte::operator/(const Byte& other) const {
+BP_NUMERIC_INLINE inline Double Byte::operator/(const Byte& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double Word::operator/(const Word& other) const {
+BP_NUMERIC_INLINE inline Double Word::operator/(const Word& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double ShortInt::operator/(const ShortInt& other) const {
+BP_NUMERIC_INLINE inline Double ShortInt::operator/(const ShortInt& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double SmallInt::operator/(const SmallInt& other) const {
+BP_NUMERIC_INLINE inline Double SmallInt::operator/(const SmallInt& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
-inline Double UInt64::operator/(const UInt64& other) const {
+BP_NUMERIC_INLINE inline Double UInt64::operator/(const UInt64& other) const {
     return Double(static_cast<double>(value) / static_cast<double>(other.value));
 }
 
@@ -1037,42 +1203,46 @@ private:
     long double value;
 
 public:
-    Extended() : value(0.0L) {}
-    Extended(long double v) : value(v) {}
-    Extended(double v) : value(static_cast<long double>(v)) {}
-    Extended(float v) : value(static_cast<long double>(v)) {}
-    Extended(int v) : value(static_cast<long double>(v)) {}
+    BP_NUMERIC_INLINE Extended() : value(0.0L) {}
+    BP_NUMERIC_INLINE Extended(long double v) : value(v) {}
+    BP_NUMERIC_INLINE Extended(double v) : value(static_cast<long double>(v)) {}
+    BP_NUMERIC_INLINE Extended(float v) : value(static_cast<long double>(v)) {}
+    BP_NUMERIC_INLINE Extended(int v) : value(static_cast<long double>(v)) {}
     
-    Extended& operator=(long double v) {
+    BP_NUMERIC_INLINE Extended& operator=(long double v) {
         value = v;
         return *this;
     }
     
-    Extended operator+(const Extended& other) const {
+    BP_NUMERIC_INLINE Extended operator+(const Extended& other) const {
         return Extended(value + other.value);
     }
     
-    Extended operator-(const Extended& other) const {
+    BP_NUMERIC_INLINE Extended operator-(const Extended& other) const {
         return Extended(value - other.value);
     }
     
-    Extended operator*(const Extended& other) const {
+    BP_NUMERIC_INLINE Extended operator*(const Extended& other) const {
         return Extended(value * other.value);
     }
     
-    Extended operator/(const Extended& other) const {
+    BP_NUMERIC_INLINE Extended operator/(const Extended& other) const {
         return Extended(value / other.value);
     }
     
-    Extended operator-() const {
+    BP_NUMERIC_INLINE Extended operator-() const {
         return Extended(-value);
     }
     
     auto operator<=>(const Extended& other) const = default;
     bool operator==(const Extended& other) const = default;
+    BP_NUMERIC_INLINE bool operator<(const Extended& other) const { return value < other.value; }
+    BP_NUMERIC_INLINE bool operator<=(const Extended& other) const { return value <= other.value; }
+    BP_NUMERIC_INLINE bool operator>(const Extended& other) const { return value > other.value; }
+    BP_NUMERIC_INLINE bool operator>=(const Extended& other) const { return value >= other.value; }
     
-    long double ToLongDouble() const { return value; }
-    explicit operator long double() const { return value; }
+    BP_NUMERIC_INLINE long double ToLongDouble() const { return value; }
+    BP_NUMERIC_INLINE explicit operator long double() const { return value; }
     
     friend std::ostream& operator<<(std::ostream& os, const Extended& e) {
         return os << e.value;
@@ -1084,120 +1254,139 @@ public:
 };
 
 // Mixed-type operations (Delphi type promotion rules)
-inline Double operator+(const Single& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator+(const Single& a, const Double& b) {
     return Double(a.ToFloat()) + b;
 }
 
-inline Double operator+(const Double& a, const Single& b) {
+BP_NUMERIC_INLINE inline Double operator+(const Double& a, const Single& b) {
     return a + Double(b.ToFloat());
 }
 
-inline Extended operator+(const Single& a, const Extended& b) {
+BP_NUMERIC_INLINE inline Extended operator+(const Single& a, const Extended& b) {
     return Extended(a.ToFloat()) + b;
 }
 
-inline Extended operator+(const Extended& a, const Single& b) {
+BP_NUMERIC_INLINE inline Extended operator+(const Extended& a, const Single& b) {
     return a + Extended(b.ToFloat());
 }
 
-inline Extended operator+(const Double& a, const Extended& b) {
+BP_NUMERIC_INLINE inline Extended operator+(const Double& a, const Extended& b) {
     return Extended(a.ToDouble()) + b;
 }
 
-inline Extended operator+(const Extended& a, const Double& b) {
+BP_NUMERIC_INLINE inline Extended operator+(const Extended& a, const Double& b) {
     return a + Extended(b.ToDouble());
 }
 
 // Mixed-type operations for Double with Integer types
-inline Double operator+(const Double& a, const Integer& b) {
+BP_NUMERIC_INLINE inline Double operator+(const Double& a, const Integer& b) {
     return Double(a.ToDouble() + static_cast<double>(b.ToInt()));
 }
 
-inline Double operator+(const Integer& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator+(const Integer& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt()) + b.ToDouble());
 }
 
-inline Double operator+(const Double& a, const Int64& b) {
+BP_NUMERIC_INLINE inline Double operator+(const Double& a, const Int64& b) {
     return Double(a.ToDouble() + static_cast<double>(b.ToInt64()));
 }
 
-inline Double operator+(const Int64& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator+(const Int64& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt64()) + b.ToDouble());
 }
 
-inline Double operator-(const Double& a, const Integer& b) {
+BP_NUMERIC_INLINE inline Double operator-(const Double& a, const Integer& b) {
     return Double(a.ToDouble() - static_cast<double>(b.ToInt()));
 }
 
-inline Double operator-(const Integer& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator-(const Integer& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt()) - b.ToDouble());
 }
 
-inline Double operator-(const Double& a, const Int64& b) {
+BP_NUMERIC_INLINE inline Double operator-(const Double& a, const Int64& b) {
     return Double(a.ToDouble() - static_cast<double>(b.ToInt64()));
 }
 
-inline Double operator-(const Int64& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator-(const Int64& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt64()) - b.ToDouble());
 }
 
-inline Double operator*(const Double& a, const Integer& b) {
+BP_NUMERIC_INLINE inline Double operator*(const Double& a, const Integer& b) {
     return Double(a.ToDouble() * static_cast<double>(b.ToInt()));
 }
 
-inline Double operator*(const Integer& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator*(const Integer& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt()) * b.ToDouble());
 }
 
-inline Double operator*(const Double& a, const Int64& b) {
+BP_NUMERIC_INLINE inline Double operator*(const Double& a, const Int64& b) {
     return Double(a.ToDouble() * static_cast<double>(b.ToInt64()));
 }
 
-inline Double operator*(const Int64& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator*(const Int64& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt64()) * b.ToDouble());
 }
 
-inline Double operator/(const Double& a, const Integer& b) {
+BP_NUMERIC_INLINE inline Double operator/(const Double& a, const Integer& b) {
     return Double(a.ToDouble() / static_cast<double>(b.ToInt()));
 }
 
-inline Double operator/(const Integer& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator/(const Integer& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt()) / b.ToDouble());
 }
 
-inline Double operator/(const Double& a, const Int64& b) {
+BP_NUMERIC_INLINE inline Double operator/(const Double& a, const Int64& b) {
     return Double(a.ToDouble() / static_cast<double>(b.ToInt64()));
 }
 
-inline Double operator/(const Int64& a, const Double& b) {
+BP_NUMERIC_INLINE inline Double operator/(const Int64& a, const Double& b) {
     return Double(static_cast<double>(a.ToInt64()) / b.ToDouble());
 }
 
 // Mixed-type operations for Integer and Int64
-inline Int64 operator+(const Integer& a, const Int64& b) {
-    return Int64(static_cast<long long>(a.ToInt()) + b.ToInt64());
+BP_NUMERIC_INLINE inline Int64 operator+(const Integer& a, const Int64& b) {
+    return Int64(internal::CheckedAdd(static_cast<long long>(a.ToInt()), b.ToInt64()));
 }
 
-inline Int64 operator+(const Int64& a, const Integer& b) {
-    return Int64(a.ToInt64() + static_cast<long long>(b.ToInt()));
+BP_NUMERIC_INLINE inline Int64 operator+(const Int64& a, const Integer& b) {
+    return Int64(internal::CheckedAdd(a.ToInt64(), static_cast<long long>(b.ToInt())));
 }
 
-inline Int64 operator-(const Integer& a, const Int64& b) {
-    return Int64(static_cast<long long>(a.ToInt()) - b.ToInt64());
+BP_NUMERIC_INLINE inline Int64 operator-(const Integer& a, const Int64& b) {
+    return Int64(internal::CheckedSub(static_cast<long long>(a.ToInt()), b.ToInt64()));
 }
 
-inline Int64 operator-(const Int64& a, const Integer& b) {
-    return Int64(a.ToInt64() - static_cast<long long>(b.ToInt()));
+BP_NUMERIC_INLINE inline Int64 operator-(const Int64& a, const Integer& b) {
+    return Int64(internal::CheckedSub(a.ToInt64(), static_cast<long long>(b.ToInt())));
 }
 
-inline Int64 operator*(const Integer& a, const Int64& b) {
-    return Int64(static_cast<long long>(a.ToInt()) * b.ToInt64());
+BP_NUMERIC_INLINE inline Int64 operator*(const Integer& a, const Int64& b) {
+    return Int64(internal::CheckedMul(static_cast<long long>(a.ToInt()), b.ToInt64()));
 }
 
-inline Int64 operator*(const Int64& a, const Integer& b) {
-    return Int64(a.ToInt64() * static_cast<long long>(b.ToInt()));
+BP_NUMERIC_INLINE inline Int64 operator*(const Int64& a, const Integer& b) {
+    return Int64(internal::CheckedMul(a.ToInt64(), static_cast<long long>(b.ToInt())));
 }
 
+// The wrappers hold a single value and copy like it, in registers
+#define BP_CHECK_NUMERIC_LAYOUT(TYPE, RAW) \
+static_assert(sizeof(TYPE) == sizeof(RAW) && std::is_trivially_copyable_v<TYPE> && std::is_standard_layout_v<TYPE>, \
+              #TYPE " must be a thin wrapper around " #RAW)
+
+BP_CHECK_NUMERIC_LAYOUT(Integer, int);
+BP_CHECK_NUMERIC_LAYOUT(Int64, long long);
+BP_CHECK_NUMERIC_LAYOUT(UInt64, unsigned long long);
+BP_CHECK_NUMERIC_LAYOUT(Cardinal, unsigned int);
+BP_CHECK_NUMERIC_LAYOUT(Byte, unsigned char);
+BP_CHECK_NUMERIC_LAYOUT(Word, unsigned short);
+BP_CHECK_NUMERIC_LAYOUT(ShortInt, signed char);
+BP_CHECK_NUMERIC_LAYOUT(SmallInt, short);
+BP_CHECK_NUMERIC_LAYOUT(Single, float);
+BP_CHECK_NUMERIC_LAYOUT(Double, double);
+BP_CHECK_NUMERIC_LAYOUT(Extended, long double);
+
+#undef BP_CHECK_NUMERIC_LAYOUT
+
 // ============================================================================
 // Char - Wraps char16_t with Pascal semantics (UTF-16, cross-platform)
 // ============================================================================
@@ -1282,334 +1471,1920 @@ public:
 };
 
 // ============================================================================
-// String - Wraps std::u16string with Pascal 1-based indexing (UTF-16, cross-platform)
+// CodeUnit - Storage unit of bp::String
+// UTF-16 by default, as in Delphi. Building with -DBP_STRING_UTF8 stores
+// strings as UTF-8 instead: Length, indexing, Copy, Pos and SetChar then count
+// bytes (like Delphi's UTF8String; SetChar only stores ASCII characters),
+// and ToUTF8/ToCharPtr return the buffer itself. Text from C++ is converted on the way in: wide literals are
+// encoded, narrow text is taken as UTF-8 (Latin-1 in UTF-16 mode)
+// ============================================================================
+#if defined(BP_STRING_UTF8)
+using CodeUnit = char;
+#else
+using CodeUnit = char16_t;
+#endif
+
+// ============================================================================
+// StringRec - Reference-counted character buffer shared by bp::String values
+// Mirrors Delphi's StrRec: a small header followed by the characters and a
+// terminating null. Assignment shares the record; writers copy it first
+// when it is shared (copy-on-write).
+// ============================================================================
+namespace internal {
+
+// UTF-8 forms of a buffer's characters for C and filesystem APIs, built on
+// first use (see String::ToCharPtr and String::NativePath). UTF-8 storage
+// needs no copy, so only the path is cached there
+struct StringShadow {
+    std::string utf8;
+    std::atomic<std::filesystem::path*> path;
+
+    explicit StringShadow(std::string text) : utf8(std::move(text)), path(nullptr) {}
+    ~StringShadow() { delete path.load(std::memory_order_relaxed); }
+};
+
+struct StringRec {
+    std::atomic<int> refCount;
+    int length;
+    int capacity;
+    mutable std::atomic<std::uint32_t> hash;  // String::Hash of the characters, 0 until computed
+    std::atomic<StringShadow*> shadow;
+
+    explicit StringRec(int cap) : refCount(1), length(0), capacity(cap), hash(0), shadow(nullptr) {}
+
+    CodeUnit* Chars() { return reinterpret_cast<CodeUnit*>(this + 1); }
+    const CodeUnit* Chars() const { return reinterpret_cast<const CodeUnit*>(this + 1); }
+
+    static StringRec* Allocate(int capacity) {
+        void* mem = ::operator new(sizeof(StringRec) + (static_cast<std::size_t>(capacity) + 1) * sizeof(CodeUnit));
+        StringRec* rec = new (mem) StringRec(capacity);
+        rec->Chars()[0] = u'\0';
+        return rec;
+    }
+
+    void AddRef() {
+        refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Release() {
+        if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete shadow.load(std::memory_order_relaxed);
+            this->~StringRec();
+            ::operator delete(this);
+        }
+    }
+
+    // Writers call this before editing the characters in place (the record is
+    // unique then, so no other String can be reading the shadow or the hash)
+    void DropCaches() {
+        hash.store(0, std::memory_order_relaxed);
+        if (StringShadow* old = shadow.load(std::memory_order_relaxed)) {
+            shadow.store(nullptr, std::memory_order_relaxed);
+            delete old;
+        }
+    }
+
+    bool IsShared() const {
+        return refCount.load(std::memory_order_acquire) != 1;
+    }
+};
+
+// String hashes are simd::HashBytes of the code units folded to 32 bits, so
+// StringRec can cache them without growing its header, then spread back over
+// a size_t. 0 means "not computed yet", so a real 0 becomes 1
+inline std::uint32_t HashUnits(const CodeUnit* chars, int length) {
+    std::uint64_t h = simd::HashBytes(chars, static_cast<std::size_t>(length) * sizeof(CodeUnit));
+    std::uint32_t folded = static_cast<std::uint32_t>(h ^ (h >> 32));
+    return folded ? folded : 1;
+}
+
+inline std::size_t SpreadHash(std::uint32_t h) {
+    return static_cast<std::size_t>(h * 0x9E3779B97F4A7C15ull);
+}
+
+// Racing threads compute the same value, so relaxed stores are enough
+inline std::size_t CachedHash(const StringRec* rec) {
+    std::uint32_t h = rec->hash.load(std::memory_order_relaxed);
+    if (h == 0) {
+        h = HashUnits(rec->Chars(), rec->length);
+        rec->hash.store(h, std::memory_order_relaxed);
+    }
+    return SpreadHash(h);
+}
+
+// Characters accepted from C++ text (literals and pointers)
+template<typename CharT>
+concept TextChar = std::same_as<CharT, char16_t> || std::same_as<CharT, wchar_t> || std::same_as<CharT, char>;
+
+template<typename P>
+concept TextPointer = std::is_pointer_v<P> && TextChar<std::remove_cv_t<std::remove_pointer_t<P>>>;
+
+// wchar_t text as the UTF-16 or UTF-32 units it holds
+inline const char16_t* WideUnits(const char16_t* s) { return s; }
+
+inline auto WideUnits(const wchar_t* s) {
+    if constexpr (sizeof(wchar_t) == sizeof(char16_t)) {
+        return reinterpret_cast<const char16_t*>(s);
+    } else {
+        return reinterpret_cast<const char32_t*>(s);
+    }
+}
+
+// Code units the C++ text s[0..length) takes in a String: the same count in
+// UTF-16 mode, its encoded size for wide text in UTF-8 mode
+template<typename CharT>
+inline int TextUnits(const CharT* s, int length) {
+#if defined(BP_STRING_UTF8)
+    if constexpr (!std::same_as<CharT, char>) {
+        return static_cast<int>(simd::Utf8Length(WideUnits(s), static_cast<std::size_t>(length)));
+    }
+#endif
+    (void)s;
+    return length;
+}
+
+// Copy C++ text into a String buffer of TextUnits(s, length) units (char is
+// Latin-1 in UTF-16 mode, as in String(const char*), and UTF-8 in UTF-8 mode)
+template<typename CharT>
+inline void CopyText(CodeUnit* dst, const CharT* s, int length) {
+#if defined(BP_STRING_UTF8)
+    if constexpr (std::same_as<CharT, char>) {
+        std::memcpy(dst, s, static_cast<std::size_t>(length));
+    } else {
+        simd::EncodeUtf8(WideUnits(s), static_cast<std::size_t>(length), dst);
+    }
+#else
+    if constexpr (sizeof(CharT) == sizeof(char16_t)) {
+        std::memcpy(dst, s, static_cast<std::size_t>(length) * sizeof(char16_t));
+    } else if constexpr (std::same_as<CharT, char>) {
+        simd::WidenLatin1(s, static_cast<std::size_t>(length), dst);
+    } else {
+        for (int i = 0; i < length; ++i) {
+            dst[i] = static_cast<char16_t>(s[i]);
+        }
+    }
+#endif
+}
+
+// Whether a buffer holds exactly the C++ text s[0..length). In UTF-8 mode wide
+// text is only compared where TextUnits(s, length) == length (ASCII text)
+template<typename CharT>
+inline bool TextEquals(const CodeUnit* chars, const CharT* s, int length) {
+    std::size_t n = static_cast<std::size_t>(length);
+#if defined(BP_STRING_UTF8)
+    if constexpr (std::same_as<CharT, char>) {
+        return simd::Mismatch(chars, s, n) == n;
+    } else if constexpr (sizeof(CharT) == sizeof(char16_t)) {
+        return simd::EqualsLatin1(reinterpret_cast<const char16_t*>(s), chars, n);
+    } else {
+        return simd::EqualsLatin1(reinterpret_cast<const std::uint32_t*>(s), chars, n);
+    }
+#else
+    if constexpr (sizeof(CharT) == sizeof(char16_t)) {
+        return simd::Mismatch(chars, reinterpret_cast<const char16_t*>(s), n) == n;
+    } else if constexpr (std::same_as<CharT, char>) {
+        return simd::EqualsLatin1(chars, s, n);
+    } else {
+        static_assert(sizeof(CharT) == sizeof(std::uint32_t));
+        return simd::EqualsWide32(chars, reinterpret_cast<const std::uint32_t*>(s), n);
+    }
+#endif
+}
+
+// Length of text in an array of 'length' characters: up to the first null
+template<typename CharT>
+inline int TextLength(const CharT* s, int length) {
+    const CharT* end = std::char_traits<CharT>::find(s, static_cast<std::size_t>(length), CharT());
+    return end ? static_cast<int>(end - s) : length;
+}
+
+// Buffers for string literals the transpiler cannot tie to a String at their
+// use site (those get BP_STRING_LITERAL and a static buffer of their own),
+// and for literals in hand-written C++. The C++ type of a literal does not
+// tell two literals apart, so they are found by address in a small
+// per-thread table for each literal length. A hit is confirmed by comparing
+// the characters (the address of a const array that is not a literal can be
+// reused for other text) and shares the buffer like a String copy. A miss
+// replaces the slot's entry: the table holds one reference on each buffer,
+// so an evicted buffer lives on in the Strings still using it and memory
+// stays bounded. Arrays whose text ends before N - 1 at a null are not
+// cached, and in UTF-8 mode neither are literals whose encoded length is not
+// N - 1 (non-ASCII text); those are converted on each use
+template<typename CharT, std::size_t N>
+struct LiteralTable {
+    struct Entry {
+        const CharT* key = nullptr;
+        StringRec* rec = nullptr;
+    };
+    static constexpr std::size_t Slots = 64;
+    Entry slots[Slots];
+
+    ~LiteralTable() {
+        for (Entry& entry : slots) {
+            if (entry.rec) {
+                entry.rec->Release();
+            }
+        }
+    }
+
+    static LiteralTable& Local() {
+        thread_local LiteralTable table;
+        return table;
+    }
+};
+
+// The literal's buffer with a reference added for the caller, or nullptr
+template<typename CharT, std::size_t N>
+inline StringRec* LiteralRec(const CharT (&s)[N]) {
+    using Table = LiteralTable<CharT, N>;
+    constexpr int length = static_cast<int>(N - 1);
+    std::uintptr_t hash = (reinterpret_cast<std::uintptr_t>(s) >> 3) * 0x9E3779B97F4A7C15ull;
+    typename Table::Entry& entry = Table::Local().slots[(hash >> 32) % Table::Slots];
+    if (entry.key != s || !TextEquals(entry.rec->Chars(), s, length)) {
+        if (TextLength(s, length) != length || TextUnits(s, length) != length) {
+            return nullptr;
+        }
+        StringRec* rec = StringRec::Allocate(length);
+        CopyText(rec->Chars(), s, length);
+        rec->length = length;
+        rec->Chars()[length] = u'\0';
+        if (entry.rec) {
+            entry.rec->Release();
+        }
+        entry = { s, rec };
+    }
+    entry.rec->AddRef();
+    return entry.rec;
+}
+
+// Size a std::string once and let 'fill' write its bytes (no zero-fill where supported)
+template<typename Fill>
+inline std::string MakeNarrow(std::size_t size, Fill fill) {
+    std::string result;
+#if defined(__cpp_lib_string_resize_and_overwrite)
+    result.resize_and_overwrite(size, [&](char* dst, std::size_t) {
+        fill(dst);
+        return size;
+    });
+#else
+    result.resize(size);
+    fill(result.data());
+#endif
+    return result;
+}
+
+// UTF-16 -> UTF-8 (unpaired surrogates become U+FFFD)
+inline std::string Utf16ToUtf8(std::u16string_view data) {
+    return MakeNarrow(simd::Utf8Length(data.data(), data.size()), [&](char* dst) {
+        simd::EncodeUtf8(data.data(), data.size(), dst);
+    });
+}
+
+// UTF-16 -> bytes, keeping the low byte of each unit (Latin-1 subset)
+inline std::string Utf16ToNarrow(std::u16string_view data) {
+    return MakeNarrow(data.size(), [&](char* dst) {
+        simd::NarrowLatin1(data.data(), data.size(), dst);
+    });
+}
+
+// A String's code units as UTF-8 and as narrow text: converted from UTF-16,
+// copied as they are from UTF-8
+inline std::string UnitsToUtf8(std::u16string_view data) { return Utf16ToUtf8(data); }
+inline std::string UnitsToUtf8(std::string_view data) { return std::string(data); }
+inline std::string UnitsToNarrow(std::u16string_view data) { return Utf16ToNarrow(data); }
+inline std::string UnitsToNarrow(std::string_view data) { return std::string(data); }
+
+// A code unit as a Char (UTF-8 bytes are zero-extended)
+inline Char UnitChar(CodeUnit unit) {
+    return Char(static_cast<char16_t>(static_cast<std::make_unsigned_t<CodeUnit>>(unit)));
+}
+
+inline constexpr CodeUnit EmptyText[1] = {};
+
+// One operand of a lazy concatenation: where its characters are and how to
+// copy them (literals are converted while copying, never materialized).
+// 'owner' is the String buffer the characters live in; StringConcat holds a
+// reference on it, TStringBuilder and String::operator+= leave it null
+struct ConcatPiece {
+    enum Kind : unsigned char { Native, Utf16, Wide, Narrow, Unit };
+    
+    const void* data;
+    int length;     // Code units it adds to the string
+    int count;      // Characters at 'data' (not 'length' when they are encoded to UTF-8)
+    Kind kind;
+    char16_t unit;  // The character itself for Kind::Unit
+    StringRec* owner = nullptr;
+    
+    void CopyTo(CodeUnit* dst) const {
+        switch (kind) {
+            case Native:
+                std::memcpy(dst, data, static_cast<std::size_t>(length) * sizeof(CodeUnit));
+                break;
+            case Utf16:
+                CopyText(dst, static_cast<const char16_t*>(data), count);
+                break;
+            case Wide:
+                CopyText(dst, static_cast<const wchar_t*>(data), count);
+                break;
+            case Narrow:
+                CopyText(dst, static_cast<const char*>(data), count);
+                break;
+            case Unit:
+                CopyText(dst, &unit, 1);
+                break;
+        }
+    }
+};
+
+template<typename CharT>
+inline ConcatPiece MakePiece(const CharT* s, int length) {
+    constexpr ConcatPiece::Kind kind = std::same_as<CharT, CodeUnit> ? ConcatPiece::Native :
+                                       std::same_as<CharT, char16_t> ? ConcatPiece::Utf16 :
+                                       std::same_as<CharT, wchar_t> ? ConcatPiece::Wide : ConcatPiece::Narrow;
+    return { s, TextUnits(s, length), length, kind, u'\0' };
+}
+
+inline ConcatPiece MakePiece(const char16_t* s) {
+    return MakePiece(s, static_cast<int>(std::char_traits<char16_t>::length(s)));
+}
+
+inline ConcatPiece MakePiece(const wchar_t* s) {
+    return MakePiece(s, static_cast<int>(std::wcslen(s)));
+}
+
+inline ConcatPiece MakePiece(const char* s) {
+    return MakePiece(s, static_cast<int>(std::strlen(s)));
+}
+
+inline ConcatPiece MakePiece(char16_t c) {
+    return { nullptr, TextUnits(&c, 1), 1, ConcatPiece::Unit, c };
+}
+
+inline ConcatPiece MakePiece(wchar_t c) {
+    return MakePiece(static_cast<char16_t>(c));
+}
+
+inline ConcatPiece MakePiece(const Char& c) {
+    return MakePiece(c.ToChar16());
+}
+
+} // namespace internal
+
+class StringView;
+class TStringBuilder;
+template<std::size_t N> class StringConcat;
+
+// ============================================================================
+// String - Copy-on-write string with Pascal 1-based indexing (UTF-16 code
+// units, or UTF-8 with BP_STRING_UTF8 - see CodeUnit)
+// Delphi semantics: assignment and by-value passing share the buffer in O(1),
+// the first write (SetChar, SetLength, +=) makes a private copy
 // ============================================================================
 class String {
+    friend class StringView;
+    friend class TStringBuilder;
+    template<std::size_t> friend class StringConcat;
+
 private:
-    std::u16string data;
-    mutable std::wstring wideCache;  // For c_str_wide() platform interop
+    internal::StringRec* rec = nullptr;  // nullptr is the empty string (Delphi nil)
+
+    // Allocate an unshared buffer of exactly 'length' characters (contents uninitialized)
+    CodeUnit* InitBuffer(int length) {
+        if (length <= 0) {
+            return nullptr;
+        }
+        rec = internal::StringRec::Allocate(length);
+        rec->length = length;
+        rec->Chars()[length] = u'\0';
+        return rec->Chars();
+    }
+    
+    void InitFrom(const CodeUnit* s, int length) {
+        if (CodeUnit* dst = InitBuffer(length)) {
+            std::memcpy(dst, s, static_cast<std::size_t>(length) * sizeof(CodeUnit));
+        }
+    }
+    
+    // Convert C++ text into a new buffer (see internal::CopyText)
+    template<typename CharT>
+    void InitText(const CharT* s, int length) {
+        if (CodeUnit* dst = InitBuffer(internal::TextUnits(s, length))) {
+            internal::CopyText(dst, s, length);
+        }
+    }
+    
+    // Amortized growth for repeated appends
+    static int GrowCapacity(int current, int needed) {
+        int grown = current + current / 2;
+        return grown > needed ? grown : needed;
+    }
+    
+    // Replace the buffer with an unshared one of 'capacity', keeping the first 'keep' characters
+    void Reallocate(int capacity, int keep) {
+        internal::StringRec* fresh = internal::StringRec::Allocate(capacity);
+        if (keep > 0) {
+            std::memcpy(fresh->Chars(), rec->Chars(), static_cast<std::size_t>(keep) * sizeof(CodeUnit));
+        }
+        fresh->length = keep;
+        fresh->Chars()[keep] = u'\0';
+        if (rec) {
+            rec->Release();
+        }
+        rec = fresh;
+    }
+    
+    void Append(const CodeUnit* s, int count) {
+        if (count <= 0) {
+            return;
+        }
+        int oldLength = Length();
+        int newLength = oldLength + count;
+        if (!rec || rec->IsShared() || rec->capacity < newLength) {
+            // Build the new buffer before releasing the old one: 's' may point into it
+            internal::StringRec* fresh = internal::StringRec::Allocate(
+                rec ? GrowCapacity(rec->capacity, newLength) : newLength);
+            if (oldLength > 0) {
+                std::memcpy(fresh->Chars(), rec->Chars(), static_cast<std::size_t>(oldLength) * sizeof(CodeUnit));
+            }
+            std::memcpy(fresh->Chars() + oldLength, s, static_cast<std::size_t>(count) * sizeof(CodeUnit));
+            if (rec) {
+                rec->Release();
+            }
+            rec = fresh;
+        } else {
+            rec->DropCaches();
+            std::memcpy(rec->Chars() + oldLength, s, static_cast<std::size_t>(count) * sizeof(CodeUnit));
+        }
+        rec->length = newLength;
+        rec->Chars()[newLength] = u'\0';
+    }
+    
+    // Append the pieces of a concatenation, growing the buffer at most once.
+    // Pieces may point into this string: they are copied before the old buffer is released
+    void AppendPieces(const internal::ConcatPiece* pieces, std::size_t count) {
+        int extra = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            extra += pieces[i].length;
+        }
+        if (extra == 0) {
+            return;
+        }
+        int oldLength = Length();
+        int newLength = oldLength + extra;
+        internal::StringRec* old = nullptr;
+        if (!rec || rec->IsShared() || rec->capacity < newLength) {
+            internal::StringRec* fresh = internal::StringRec::Allocate(
+                rec ? GrowCapacity(rec->capacity, newLength) : newLength);
+            if (oldLength > 0) {
+                std::memcpy(fresh->Chars(), rec->Chars(), static_cast<std::size_t>(oldLength) * sizeof(CodeUnit));
+            }
+            old = rec;
+            rec = fresh;
+        } else {
+            rec->DropCaches();
+        }
+        CodeUnit* dst = rec->Chars() + oldLength;
+        for (std::size_t i = 0; i < count; ++i) {
+            pieces[i].CopyTo(dst);
+            dst += pieces[i].length;
+        }
+        rec->length = newLength;
+        rec->Chars()[newLength] = u'\0';
+        if (old) {
+            old->Release();
+        }
+    }
+    
+    // The buffer's UTF-8 shadow, built once (rec must be non-null). Racing
+    // readers build identical copies; the first one published wins
+    internal::StringShadow& Shadow() const {
+        if (internal::StringShadow* shadow = rec->shadow.load(std::memory_order_acquire)) {
+            return *shadow;
+        }
+#if defined(BP_STRING_UTF8)
+        auto* fresh = new internal::StringShadow(std::string());
+#else
+        auto* fresh = new internal::StringShadow(ToUTF8());
+#endif
+        internal::StringShadow* expected = nullptr;
+        if (!rec->shadow.compare_exchange_strong(expected, fresh, std::memory_order_acq_rel)) {
+            delete fresh;
+            return *expected;
+        }
+        return *fresh;
+    }
 
 public:
     String() = default;
-    String(const char16_t* s) : data(s) {}
-    String(const std::u16string& s) : data(s) {}
-    String(char16_t c) : data(1, c) {}
+    String(const std::u16string& s) { InitText(s.data(), static_cast<int>(s.length())); }
+    explicit String(std::u16string_view s) { InitText(s.data(), static_cast<int>(s.length())); }
+    String(char16_t c) { InitText(&c, 1); }
+    
+    // Literals (L"...", u"...", "..."; narrow text is Latin-1): the characters
+    // are converted once into a cached buffer (see LiteralRec), and evaluating
+    // the same literal again shares it with no allocation or conversion. Like
+    // any C text, a const array is read up to its first null, so a buffer
+    // holding shorter text is not taken at its full size
+    template<typename CharT, std::size_t N> requires internal::TextChar<CharT>
+    String(const CharT (&s)[N]) {
+        if constexpr (N > 1) {
+            rec = internal::LiteralRec(s);
+            if (!rec) {
+                InitText(s, internal::TextLength(s, static_cast<int>(N - 1)));
+            }
+        }
+    }
+    
+    // A literal's own buffer, bypassing the cache (for BP_STRING_LITERAL)
+    template<typename CharT, std::size_t N> requires internal::TextChar<CharT>
+    static String FromLiteral(const CharT (&s)[N]) {
+        String result;
+        result.InitText(s, internal::TextLength(s, static_cast<int>(N - 1)));
+        return result;
+    }
+    
+    // Writable character arrays are C buffers: the text ends at the first null
+    template<typename CharT, std::size_t N> requires internal::TextChar<CharT>
+    String(CharT (&s)[N]) : String(static_cast<const CharT*>(s)) {}
+    
+    // Null-terminated text of unknown length (a template, so that arrays
+    // prefer the literal constructors above)
+    template<typename P> requires internal::TextPointer<P>
+    String(const P& s) {
+        using CharT = std::remove_cv_t<std::remove_pointer_t<P>>;
+        InitText(static_cast<const CharT*>(s), static_cast<int>(std::char_traits<CharT>::length(s)));
+    }
     
-    // Support narrow string literals for compatibility (ASCII subset)
-    String(const char* s) {
-        data.reserve(strlen(s));
-        for (size_t i = 0; s[i] != '\0'; ++i) {
-            data += static_cast<char16_t>(static_cast<unsigned char>(s[i]));
+    // Materialize a slice (shares the buffer when the view covers all of it)
+    String(const StringView& v);
+    
+    String(const std::wstring& s) { InitText(s.data(), static_cast<int>(s.length())); }
+    
+    // Sharing copy (O(1)) - the buffer is only duplicated on the first write
+    String(const String& other) : rec(other.rec) {
+        if (rec) {
+            rec->AddRef();
         }
     }
     
-    // Support wide string literals for platform interop
-    String(const wchar_t* s) {
-        while (*s) {
-            data += static_cast<char16_t>(*s++);
+    String(String&& other) noexcept : rec(other.rec) {
+        other.rec = nullptr;
+    }
+    
+    ~String() {
+        if (rec) {
+            rec->Release();
         }
     }
     
-    String(const std::wstring& s) {
-        data.reserve(s.length());
-        for (wchar_t wc : s) {
-            data += static_cast<char16_t>(wc);
+    String& operator=(const String& other) {
+        if (other.rec) {
+            other.rec->AddRef();
         }
+        if (rec) {
+            rec->Release();
+        }
+        rec = other.rec;
+        return *this;
     }
     
-    String& operator=(const char16_t* s) {
-        data = s;
+    String& operator=(String&& other) noexcept {
+        std::swap(rec, other.rec);
         return *this;
     }
     
+    template<typename CharT, std::size_t N> requires internal::TextChar<std::remove_const_t<CharT>>
+    String& operator=(CharT (&s)[N]) {
+        return *this = String(s);
+    }
+    
+    template<typename P> requires internal::TextPointer<P>
+    String& operator=(const P& s) {
+        return *this = String(s);
+    }
+    
     String& operator=(const std::u16string& s) {
-        data = s;
-        return *this;
+        return *this = String(s);
     }
     
     String& operator=(char16_t c) {
-        data = std::u16string(1, c);
-        return *this;
+        return *this = String(c);
     }
     
-    String& operator=(const char* s) {
-        data.clear();
-        data.reserve(strlen(s));
-        for (size_t i = 0; s[i] != '\0'; ++i) {
-            data += static_cast<char16_t>(static_cast<unsigned char>(s[i]));
-        }
-        return *this;
+    String& operator=(const StringView& v) {
+        return *this = String(v);  // Built first: v may point into this string
     }
     
-    // Concatenation (binary + for occasional use)
-    String operator+(const String& other) const {
-        return String(data + other.data);
+    // Concatenation: '+' builds a StringConcat (see below) that is copied
+    // into a single exact-size buffer here
+    template<std::size_t N>
+    String(const StringConcat<N>& c) {
+        if (CodeUnit* dst = InitBuffer(c.Length())) {
+            for (const internal::ConcatPiece& piece : c.pieces) {
+                piece.CopyTo(dst);
+                dst += piece.length;
+            }
+        }
     }
     
-    String operator+(const char16_t* other) const {
-        return String(data + other);
+    // S := S + X appends to S's own buffer (amortized growth) instead of
+    // building a new string; any other chain is materialized once. The
+    // chain's reference on S is dropped first so S can grow in place
+    template<std::size_t N>
+    String& operator=(StringConcat<N> c) {
+        internal::ConcatPiece& head = c.pieces[0];
+        if (head.kind == internal::ConcatPiece::Native && head.data == c_str() && head.length == Length() &&
+            head.owner == rec) {
+            if (head.owner) {
+                head.owner->Release();
+                head.owner = nullptr;
+            }
+            AppendPieces(c.pieces.data() + 1, N - 1);
+            return *this;
+        }
+        return *this = String(c);
     }
     
-    String operator+(char16_t c) const {
-        return String(data + c);
+    template<std::size_t N>
+    String& operator+=(const StringConcat<N>& c) {
+        AppendPieces(c.pieces.data(), N);
+        return *this;
     }
     
     // OPTIMIZED: In-place concatenation (PREFERRED!)
     String& operator+=(const String& other) {
-        data += other.data;
+        if (!rec) {
+            return *this = other;  // Empty + X shares X
+        }
+        Append(other.c_str(), other.Length());
         return *this;
     }
     
+    String& operator+=(const StringView& other);
+    
     String& operator+=(const char16_t* other) {
-        data += other;
+        internal::ConcatPiece piece = internal::MakePiece(other);
+        AppendPieces(&piece, 1);
         return *this;
     }
     
     String& operator+=(char16_t c) {
-        data += c;
+        internal::ConcatPiece piece = internal::MakePiece(c);
+        AppendPieces(&piece, 1);
         return *this;
     }
     
-    // Friend operators for literal + String (handles L"...", u"...", and "..." literals)
-    friend String operator+(const wchar_t* lhs, const String& rhs) {
-        String result(lhs);
-        result.data += rhs.data;
-        return result;
-    }
-    
-    friend String operator+(const char16_t* lhs, const String& rhs) {
-        String result(lhs);
-        result.data += rhs.data;
-        return result;
+    // Ordinal (code unit) comparison, like Delphi's CompareStr
+    std::strong_ordering operator<=>(const String& other) const {
+        int cmp = simd::Compare(c_str(), static_cast<std::size_t>(Length()),
+                                other.c_str(), static_cast<std::size_t>(other.Length()));
+        return cmp <=> 0;
     }
     
-    friend String operator+(const char* lhs, const String& rhs) {
-        String result(lhs);
-        result.data += rhs.data;
-        return result;
+    bool operator==(const String& other) const {
+        if (rec == other.rec) return true;
+        int len = Length();
+        return len == other.Length() &&
+               simd::Mismatch(c_str(), other.c_str(), static_cast<std::size_t>(len)) == static_cast<std::size_t>(len);
     }
     
-    auto operator<=>(const String& other) const = default;
-    bool operator==(const String& other) const = default;
-    
     // 1-based indexing (CRITICAL: Pascal semantics!)
     // Returns Char by value to enable comparison operators
     Char operator[](int index) const {
-        return Char(data[index - 1]);
+        internal::CheckIndex(index - 1, Length(), 1);
+        return internal::UnitChar(c_str()[index - 1]);
     }
     
     Char operator[](const Integer& index) const {
-        return Char(data[index.ToInt() - 1]);
+        return (*this)[index.ToInt()];
     }
     
-    // For write access, provide SetChar method
+    // For write access, provide SetChar method (copies a shared buffer first)
     void SetChar(int index, const Char& ch) {
-        data[index - 1] = ch.ToChar16();
+        SetChar(index, ch.ToChar16());
     }
     
+    // Stores one code unit. In UTF-8 mode that is one byte, so a non-ASCII
+    // 'ch' (which needs two or more) raises ERangeError instead of being cut
+    // to its low byte
     void SetChar(int index, char16_t ch) {
-        data[index - 1] = ch;
+        internal::CheckIndex(index - 1, Length(), 1);
+#if defined(BP_STRING_UTF8)
+        if (ch > 0x7F) [[unlikely]] {
+            internal::RaiseCharRangeError(ch);
+        }
+#endif
+        MakeUnique();
+        rec->DropCaches();
+        rec->Chars()[index - 1] = static_cast<CodeUnit>(ch);
     }
     
     // Properties
-    int Length() const { return static_cast<int>(data.length()); }
+    int Length() const { return rec ? rec->length : 0; }
     
+    // Delphi SetLength: keeps the common prefix and always leaves the string unique
     void SetLength(int newlen) {
-        data.resize(newlen);
+        if (newlen <= 0) {
+            *this = String();
+            return;
+        }
+        int oldLength = Length();
+        if (!rec || rec->IsShared() || rec->capacity < newlen) {
+            Reallocate(newlen, oldLength < newlen ? oldLength : newlen);
+        } else {
+            rec->DropCaches();
+        }
+        if (newlen > oldLength) {
+            std::fill(rec->Chars() + oldLength, rec->Chars() + newlen, CodeUnit());
+        }
+        rec->length = newlen;
+        rec->Chars()[newlen] = u'\0';
     }
     
-    // Cross-platform API interop - returns wchar_t* for platform-specific APIs
-    const wchar_t* c_str_wide() const {
-#ifdef _WIN32
-        // On Windows, wchar_t is 16-bit, direct cast is safe
-        return reinterpret_cast<const wchar_t*>(data.c_str());
-#else
-        // On Linux/macOS, wchar_t is 32-bit, need conversion
-        wideCache.clear();
-        wideCache.reserve(data.size());
-        for (char16_t ch : data) {
-            wideCache += static_cast<wchar_t>(ch);
+    // Delphi UniqueString: give this string a private copy of a shared buffer
+    void MakeUnique() {
+        if (rec && rec->IsShared()) {
+            Reallocate(rec->length, rec->length);
         }
-        return wideCache.c_str();
-#endif
     }
     
-    // UTF-16 pointer (cross-platform consistent)
-    const char16_t* c_str() const { return data.c_str(); }
-    
-    // UTF-8 conversion for proper console/exception output
-    std::string ToUTF8() const {
-        std::string result;
-        size_t i = 0;
-        while (i < data.size()) {
-            uint32_t codepoint = data[i];
-            
-            // Handle surrogate pairs
-            if (codepoint >= 0xD800 && codepoint <= 0xDBFF && i + 1 < data.size()) {
-                uint32_t high = codepoint;
-                uint32_t low = data[i + 1];
-                if (low >= 0xDC00 && low <= 0xDFFF) {
-                    codepoint = 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00);
-                    i += 2;
-                } else {
-                    i++;
-                    continue;
-                }
-            } else {
-                i++;
-            }
-            
-            // Convert codepoint to UTF-8
-            if (codepoint <= 0x7F) {
-                result += static_cast<char>(codepoint);
-            } else if (codepoint <= 0x7FF) {
-                result += static_cast<char>(0xC0 | (codepoint >> 6));
-                result += static_cast<char>(0x80 | (codepoint & 0x3F));
-            } else if (codepoint <= 0xFFFF) {
-                result += static_cast<char>(0xE0 | (codepoint >> 12));
-                result += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
-                result += static_cast<char>(0x80 | (codepoint & 0x3F));
-            } else {
-                result += static_cast<char>(0xF0 | (codepoint >> 18));
-                result += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
-                result += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
-                result += static_cast<char>(0x80 | (codepoint & 0x3F));
-            }
+    // Characters the buffer can hold before the next append reallocates
+    int Capacity() const { return rec ? rec->capacity : 0; }
+    
+    // Make the buffer unique with room for at least 'capacity' characters
+    void Reserve(int capacity) {
+        if (capacity <= 0 && !rec) {
+            return;
+        }
+        if (!rec || rec->IsShared() || rec->capacity < capacity) {
+            int length = Length();
+            Reallocate(capacity > length ? capacity : length, length);
         }
-        return result;
     }
     
-    // C API interop - returns const char* (UTF-8) for C APIs that expect narrow strings
-    // Uses thread-local storage to keep the string alive during the function call
-    const char* ToCharPtr() const;
-    
-    // Legacy narrow string support (converts on demand, ASCII subset)
-    std::string ToNarrow() const {
-        std::string result;
-        result.reserve(data.length());
-        for (char16_t c : data) {
-            result += static_cast<char>(c);
+    // Delphi Delete: remove 'count' characters at 1-based 'index' in place.
+    // An out-of-range index is a no-op; count is clamped to the end of the string
+    void Delete(int index, int count) {
+        int oldLength = Length();
+        if (index < 1 || index > oldLength || count <= 0) {
+            return;
         }
-        return result;
+        if (count > oldLength - index + 1) {
+            count = oldLength - index + 1;
+        }
+        int newLength = oldLength - count;
+        if (newLength == 0) {
+            *this = String();
+            return;
+        }
+        int at = index - 1;
+        int tail = newLength - at;
+        if (rec->IsShared()) {
+            // Copy around the gap rather than duplicating and then shifting
+            internal::StringRec* fresh = internal::StringRec::Allocate(newLength);
+            std::memcpy(fresh->Chars(), rec->Chars(), static_cast<std::size_t>(at) * sizeof(CodeUnit));
+            std::memcpy(fresh->Chars() + at, rec->Chars() + at + count, static_cast<std::size_t>(tail) * sizeof(CodeUnit));
+            rec->Release();
+            rec = fresh;
+        } else {
+            rec->DropCaches();
+            std::memmove(rec->Chars() + at, rec->Chars() + at + count, static_cast<std::size_t>(tail) * sizeof(CodeUnit));
+        }
+        rec->length = newLength;
+        rec->Chars()[newLength] = u'\0';
     }
     
-    // Access internal std::u16string
-    const std::u16string& GetStdU16String() const { return data; }
-    std::u16string& GetStdU16String() { return data; }
+    // Delphi Insert: insert 'count' characters at 1-based 'index' (clamped to
+    // 1..Length+1), shifting the tail within the existing buffer when it is
+    // unique and has room
+    void Insert(int index, const CodeUnit* s, int count) {
+        if (count <= 0) {
+            return;
+        }
+        int oldLength = Length();
+        if (index < 1) {
+            index = 1;
+        } else if (index > oldLength + 1) {
+            index = oldLength + 1;
+        }
+        int at = index - 1;
+        int newLength = oldLength + count;
+        const CodeUnit* chars = c_str();
+        bool aliased = std::less_equal<const CodeUnit*>()(chars, s) &&
+                       std::less<const CodeUnit*>()(s, chars + oldLength + 1);
+        if (!rec || rec->IsShared() || rec->capacity < newLength || aliased) {
+            // Build the new buffer before releasing the old one: 's' may point into it
+            internal::StringRec* fresh = internal::StringRec::Allocate(
+                rec ? GrowCapacity(rec->capacity, newLength) : newLength);
+            std::memcpy(fresh->Chars(), chars, static_cast<std::size_t>(at) * sizeof(CodeUnit));
+            std::memcpy(fresh->Chars() + at, s, static_cast<std::size_t>(count) * sizeof(CodeUnit));
+            std::memcpy(fresh->Chars() + at + count, chars + at, static_cast<std::size_t>(oldLength - at) * sizeof(CodeUnit));
+            if (rec) {
+                rec->Release();
+            }
+            rec = fresh;
+        } else {
+            rec->DropCaches();
+            CodeUnit* dst = rec->Chars();
+            std::memmove(dst + at + count, dst + at, static_cast<std::size_t>(oldLength - at) * sizeof(CodeUnit));
+            std::memcpy(dst + at, s, static_cast<std::size_t>(count) * sizeof(CodeUnit));
+        }
+        rec->length = newLength;
+        rec->Chars()[newLength] = u'\0';
+    }
     
-    friend std::ostream& operator<<(std::ostream& os, const String& s) {
-        os << s.ToUTF8();
-        return os;
+    // Reference count of the shared buffer (0 for the empty string)
+    int RefCount() const {
+        return rec ? rec->refCount.load(std::memory_order_relaxed) : 0;
+    }
+    
+#if defined(_WIN32) && !defined(BP_STRING_UTF8)
+    // Windows API interop: wchar_t is UTF-16 there, so this is the buffer itself
+    const wchar_t* c_str_wide() const {
+        return reinterpret_cast<const wchar_t*>(c_str());
+    }
+#endif
+    
+    // The string as a filesystem path (UTF-16 on Windows, UTF-8 elsewhere),
+    // converted on first use and cached on the buffer until it is edited.
+    // Copies of the string share it, so repeated FileExists/Reset calls on
+    // the same name convert it once
+    const std::filesystem::path& NativePath() const {
+        static const std::filesystem::path empty;
+        if (!rec) {
+            return empty;
+        }
+        internal::StringShadow& shadow = Shadow();
+        if (std::filesystem::path* path = shadow.path.load(std::memory_order_acquire)) {
+            return *path;
+        }
+#if defined(BP_STRING_UTF8)
+        auto* fresh = new std::filesystem::path(std::u8string_view(reinterpret_cast<const char8_t*>(c_str()), static_cast<std::size_t>(Length())));
+#elif defined(_WIN32)
+        auto* fresh = new std::filesystem::path(std::wstring_view(reinterpret_cast<const wchar_t*>(c_str()), static_cast<std::size_t>(Length())));
+#else
+        auto* fresh = new std::filesystem::path(shadow.utf8);
+#endif
+        std::filesystem::path* expected = nullptr;
+        if (!shadow.path.compare_exchange_strong(expected, fresh, std::memory_order_acq_rel)) {
+            delete fresh;  // Another thread cached the same path first
+            return *expected;
+        }
+        return *fresh;
+    }
+    
+    // Code unit pointer (UTF-16, or UTF-8 with BP_STRING_UTF8; always null-terminated)
+    const CodeUnit* c_str() const { return rec ? rec->Chars() : internal::EmptyText; }
+    
+    // Read-only view of the characters (no copy)
+    std::basic_string_view<CodeUnit> View() const {
+        return std::basic_string_view<CodeUnit>(c_str(), static_cast<std::size_t>(Length()));
+    }
+    
+    // Hash of the characters, cached in the buffer after the first call.
+    // Equal strings, and a StringView of the same text, hash alike
+    std::size_t Hash() const {
+        return rec ? internal::CachedHash(rec) : internal::SpreadHash(internal::HashUnits(internal::EmptyText, 0));
+    }
+    
+    // UTF-8 conversion for proper console/exception output (a plain copy in UTF-8 mode)
+    std::string ToUTF8() const { return internal::UnitsToUtf8(View()); }
+    
+    // Build a new string of exactly 'length' characters; 'fill' must write all of them
+    template<typename Fill>
+    static String Create(int length, Fill fill) {
+        String result;
+        if (CodeUnit* dst = result.InitBuffer(length)) {
+            fill(dst);
+        }
+        return result;
+    }
+    
+    // UTF-8 -> String (invalid sequences become U+FFFD; copied as-is in UTF-8 mode)
+    static String FromUTF8(std::string_view s) {
+        String result;
+#if defined(BP_STRING_UTF8)
+        result.InitFrom(s.data(), static_cast<int>(s.size()));
+#else
+        if (!s.empty()) {
+            // UTF-8 never yields more UTF-16 units than it has bytes
+            result.rec = internal::StringRec::Allocate(static_cast<int>(s.size()));
+            int length = static_cast<int>(simd::DecodeUtf8(s.data(), s.size(), result.rec->Chars()));
+            result.rec->length = length;
+            result.rec->Chars()[length] = u'\0';
+        }
+#endif
+        return result;
+    }
+    
+    // C API interop - returns const char* (UTF-8) for C APIs that expect narrow strings.
+    // The UTF-8 copy is cached on the buffer: it stays valid until this string is
+    // edited or released, each string has its own (several may be passed to one
+    // call), and an unchanged string is not converted again. In UTF-8 mode this
+    // is the buffer itself
+    const char* ToCharPtr() const {
+#if defined(BP_STRING_UTF8)
+        return c_str();
+#else
+        return rec ? Shadow().utf8.c_str() : "";
+#endif
+    }
+    
+    // Legacy narrow string support (converts on demand, ASCII subset; the
+    // UTF-8 bytes in UTF-8 mode)
+    std::string ToNarrow() const { return internal::UnitsToNarrow(View()); }
+    
+    // Copy of the characters as std::u16string (prefer View() for read-only access)
+    std::u16string GetStdU16String() const {
+#if defined(BP_STRING_UTF8)
+        std::u16string result(static_cast<std::size_t>(Length()), u'\0');
+        result.resize(simd::DecodeUtf8(c_str(), result.size(), result.data()));
+        return result;
+#else
+        return std::u16string(View());
+#endif
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const String& s) {
+#if defined(BP_STRING_UTF8)
+        os.write(s.c_str(), s.Length());
+#else
+        os << s.ToUTF8();
+#endif
+        return os;
     }
 };
 
+// A string literal the transpiler knows becomes a String (S := 'text', or an
+// argument for a string parameter). Each use site is its own lambda, so its
+// static is a buffer for that literal alone: built on the first evaluation,
+// never freed, and shared by every later evaluation with no lookup,
+// conversion or allocation. Other literals go through the String(const
+// CharT (&)[N]) cache
+#define BP_STRING_LITERAL(s) \
+    ([]() -> const ::bp::String& { \
+        static const ::bp::String* const literal = new ::bp::String(::bp::String::FromLiteral(s)); \
+        return *literal; \
+    }())
+
+// ============================================================================
+// StringView - Slice of a String with Pascal 1-based indexing
+// Returned by Copy and Trim so slicing allocates nothing; it turns into a
+// String only when stored. A view of a String shares its buffer (one
+// reference count, like a String copy), so it may outlive the String it came
+// from. A view of raw characters only borrows them. Not null-terminated.
+// ============================================================================
+class StringView {
+    friend class String;
+    template<std::size_t> friend class StringConcat;
+
+private:
+    const CodeUnit* ptr = internal::EmptyText;
+    int len = 0;
+    internal::StringRec* owner = nullptr;  // Buffer the slice points into; the view holds a reference on it
+
+    StringView(const CodeUnit* data, int length, const internal::StringRec* rec)
+        : ptr(data), len(length), owner(const_cast<internal::StringRec*>(rec)) {
+        if (owner) {
+            owner->AddRef();
+        }
+    }
+    
+    // Delphi Copy semantics: index < 1 counts from 1, out-of-range index or
+    // count <= 0 gives an empty view, count is clamped to the end
+    static StringView SliceOf(const CodeUnit* data, int length, const internal::StringRec* rec, int index, int count) {
+        if (index < 1) {
+            index = 1;
+        }
+        if (index > length || count <= 0) {
+            return StringView();
+        }
+        if (count > length - index + 1) {
+            count = length - index + 1;
+        }
+        return StringView(data + index - 1, count, rec);
+    }
+    
+    // Compare with C++ text without converting it (in UTF-8 mode, wide text
+    // that is not ASCII is compared in its encoded form)
+    template<typename CharT>
+    static bool EqualsText(const StringView& a, const CharT* b) {
+        int n = static_cast<int>(std::char_traits<CharT>::length(b));
+        if (internal::TextUnits(b, n) != n) {
+            return a == StringView(String(b));
+        }
+        return a.len == n && internal::TextEquals(a.ptr, b, n);
+    }
+
+public:
+    StringView() = default;
+    
+    // Borrows the characters: the caller keeps them alive while the view is used
+    StringView(const CodeUnit* data, int length) : ptr(data), len(length) {}
+    
+    // A view of a String (or a slice of one) shares its buffer like a String
+    // copy does: one reference count increment, no allocation. So a view of a
+    // temporary, such as Copy(A + B, 1, 3), stays valid after the temporary dies
+    explicit StringView(const String& s) : StringView(s.c_str(), s.Length(), s.rec) {}
+    
+    StringView(const StringView& other) : StringView(other.ptr, other.len, other.owner) {}
+    
+    StringView(StringView&& other) noexcept : ptr(other.ptr), len(other.len), owner(other.owner) {
+        other.ptr = internal::EmptyText;
+        other.len = 0;
+        other.owner = nullptr;
+    }
+    
+    StringView& operator=(StringView other) noexcept {
+        std::swap(ptr, other.ptr);
+        std::swap(len, other.len);
+        std::swap(owner, other.owner);
+        return *this;
+    }
+    
+    ~StringView() {
+        if (owner) {
+            owner->Release();
+        }
+    }
+    
+    static StringView Slice(const String& s, int index, int count) {
+        return SliceOf(s.c_str(), s.Length(), s.rec, index, count);
+    }
+    
+    StringView Slice(int index, int count) const {
+        return SliceOf(ptr, len, owner, index, count);
+    }
+    
+    // 1-based indexing, like String
+    Char operator[](int index) const {
+        internal::CheckIndex(index - 1, len, 1);
+        return internal::UnitChar(ptr[index - 1]);
+    }
+    
+    Char operator[](const Integer& index) const {
+        return (*this)[index.ToInt()];
+    }
+    
+    int Length() const { return len; }
+    const CodeUnit* Data() const { return ptr; }
+    std::basic_string_view<CodeUnit> View() const { return std::basic_string_view<CodeUnit>(ptr, static_cast<std::size_t>(len)); }
+    
+    // Same value as String::Hash; a view of a whole string uses its cached hash
+    std::size_t Hash() const {
+        if (owner && ptr == owner->Chars() && len == owner->length) {
+            return internal::CachedHash(owner);
+        }
+        return internal::SpreadHash(internal::HashUnits(ptr, len));
+    }
+    
+    String ToString() const { return String(*this); }
+    std::string ToUTF8() const { return internal::UnitsToUtf8(View()); }
+    
+    std::string ToNarrow() const { return internal::UnitsToNarrow(View()); }
+    
+    // Comparisons against views, Strings and literals - no temporaries
+    friend bool operator==(const StringView& a, const StringView& b) {
+        return a.len == b.len &&
+               simd::Mismatch(a.ptr, b.ptr, static_cast<std::size_t>(a.len)) == static_cast<std::size_t>(a.len);
+    }
+    
+    friend bool operator==(const StringView& a, const String& b) {
+        return a == StringView(b.c_str(), b.Length());
+    }
+    
+    friend bool operator==(const StringView& a, const wchar_t* b) {
+        return EqualsText(a, b);
+    }
+    
+    friend bool operator==(const StringView& a, const char16_t* b) {
+        return EqualsText(a, b);
+    }
+    
+    friend std::strong_ordering operator<=>(const StringView& a, const StringView& b) {
+        return simd::Compare(a.ptr, static_cast<std::size_t>(a.len), b.ptr, static_cast<std::size_t>(b.len)) <=> 0;
+    }
+    
+    friend std::strong_ordering operator<=>(const StringView& a, const String& b) {
+        return a <=> StringView(b.c_str(), b.Length());
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const StringView& v) {
+#if defined(BP_STRING_UTF8)
+        os.write(v.ptr, v.len);
+#else
+        os << v.ToUTF8();
+#endif
+        return os;
+    }
+};
+
+inline String::String(const StringView& v) {
+    if (v.owner && v.ptr == v.owner->Chars() && v.len == v.owner->length) {
+        rec = const_cast<internal::StringRec*>(v.owner);
+        rec->AddRef();
+    } else {
+        InitFrom(v.ptr, v.len);
+    }
+}
+
+inline String& String::operator+=(const StringView& other) {
+    if (!rec) {
+        return *this = String(other);
+    }
+    Append(other.ptr, other.len);
+    return *this;
+}
+
+// ============================================================================
+// StringConcat - Lazy result of '+' on strings
+// A + ', ' + B + ' = ' + IntToStr(N) records where each operand's characters
+// are and copies them once, into a buffer of the summed length, when the
+// chain is assigned to or converted to String. String and StringView operands
+// are not copied, but the chain holds a reference on their buffers (taken
+// over from temporaries), so it stays valid after the expression ends.
+// Literals are static; a char pointer to a local buffer must outlive it
+// ============================================================================
+namespace internal {
+
+inline ConcatPiece MakePiece(const String& s) {
+    return { s.c_str(), s.Length(), s.Length(), ConcatPiece::Native, u'\0' };
+}
+
+inline ConcatPiece MakePiece(const StringView& s) {
+    return { s.Data(), s.Length(), s.Length(), ConcatPiece::Native, u'\0' };
+}
+
+template<typename T>
+struct ConcatCount : std::integral_constant<std::size_t, 1> {};
+
+template<std::size_t N>
+struct ConcatCount<StringConcat<N>> : std::integral_constant<std::size_t, N> {};
+
+// Operands that make '+' a string concatenation...
+template<typename T>
+concept ConcatString = std::same_as<T, String> || std::same_as<T, StringView> ||
+                       (ConcatCount<T>::value > 1);
+
+// ...the string literals...
+template<typename T>
+concept ConcatText = std::same_as<T, const wchar_t*> || std::same_as<T, wchar_t*> ||
+                     std::same_as<T, const char16_t*> || std::same_as<T, char16_t*> ||
+                     std::same_as<T, const char*> || std::same_as<T, char*>;
+
+// ...and the literals/characters that may join them
+template<typename T>
+concept ConcatLiteral = ConcatText<T> || std::same_as<T, wchar_t> || std::same_as<T, char16_t> ||
+                        std::same_as<T, Char>;
+
+// At least one side must be a string or a string literal ('x' + C), so '+' on
+// two characters, or on a character and a number, stays arithmetic
+template<typename A, typename B>
+concept ConcatOperands = (ConcatString<A> && (ConcatString<B> || ConcatLiteral<B>)) ||
+                         (ConcatLiteral<A> && ConcatString<B>) ||
+                         (std::same_as<A, Char> && ConcatText<B>) ||
+                         (ConcatText<A> && std::same_as<B, Char>);
+
+} // namespace internal
+
+template<std::size_t N>
+class StringConcat {
+    template<std::size_t> friend class StringConcat;
+    friend class String;
+
+private:
+    std::array<internal::ConcatPiece, N> pieces;
+    
+    template<std::size_t M>
+    void Add(const StringConcat<M>& c, std::size_t& at) {
+        for (const internal::ConcatPiece& piece : c.pieces) {
+            if (piece.owner) {
+                piece.owner->AddRef();
+            }
+            pieces[at++] = piece;
+        }
+    }
+    
+    // A temporary chain hands its references over
+    template<std::size_t M>
+    void Add(StringConcat<M>&& c, std::size_t& at) {
+        for (internal::ConcatPiece& piece : c.pieces) {
+            pieces[at++] = piece;
+            piece.owner = nullptr;
+        }
+    }
+    
+    template<typename T> requires (internal::ConcatCount<std::remove_cvref_t<T>>::value == 1)
+    void Add(T&& operand, std::size_t& at) {
+        using U = std::remove_reference_t<T>;
+        if constexpr (std::is_array_v<U> && std::is_const_v<std::remove_extent_t<U>>) {
+#if defined(BP_STRING_UTF8)
+            // Wide literals are copied from their cached UTF-8 buffer instead of being encoded again
+            if constexpr (!std::same_as<std::remove_const_t<std::remove_extent_t<U>>, char> && std::extent_v<U> > 1) {
+                if (internal::StringRec* rec = internal::LiteralRec(operand)) {
+                    pieces[at++] = { rec->Chars(), rec->length, rec->length, internal::ConcatPiece::Native, u'\0', rec };
+                    return;
+                }
+            }
+#endif
+            // A literal's length is bounded by its type (the text ends at a null before that)
+            using CharT = std::remove_const_t<std::remove_extent_t<U>>;
+            pieces[at++] = internal::MakePiece(static_cast<const CharT*>(operand),
+                                               internal::TextLength(static_cast<const CharT*>(operand),
+                                                                    static_cast<int>(std::extent_v<U> - 1)));
+        } else if constexpr (std::same_as<std::remove_cvref_t<T>, String>) {
+            pieces[at] = internal::MakePiece(operand);
+            pieces[at++].owner = Hold(operand.rec, std::is_rvalue_reference_v<T&&> && !std::is_const_v<U>);
+        } else if constexpr (std::same_as<std::remove_cvref_t<T>, StringView>) {
+            pieces[at] = internal::MakePiece(operand);
+            pieces[at++].owner = Hold(operand.owner, std::is_rvalue_reference_v<T&&> && !std::is_const_v<U>);
+        } else {
+            pieces[at++] = internal::MakePiece(operand);
+        }
+    }
+    
+    // A reference on an operand's buffer: taken over from a temporary, added otherwise
+    template<typename Rec>
+    static internal::StringRec* Hold(Rec& rec, bool temporary) {
+        internal::StringRec* held = const_cast<internal::StringRec*>(rec);
+        if (temporary) {
+            if constexpr (!std::is_const_v<Rec>) {
+                rec = nullptr;
+            }
+        } else if (held) {
+            held->AddRef();
+        }
+        return held;
+    }
+    
+    void Swap(StringConcat& other) noexcept {
+        std::swap(pieces, other.pieces);
+    }
+
+public:
+    template<typename A, typename B>
+    StringConcat(A&& a, B&& b) {
+        std::size_t at = 0;
+        Add(std::forward<A>(a), at);
+        Add(std::forward<B>(b), at);
+    }
+    
+    StringConcat(const StringConcat& other) : pieces(other.pieces) {
+        for (internal::ConcatPiece& piece : pieces) {
+            if (piece.owner) {
+                piece.owner->AddRef();
+            }
+        }
+    }
+    
+    StringConcat(StringConcat&& other) noexcept : pieces(other.pieces) {
+        for (internal::ConcatPiece& piece : other.pieces) {
+            piece.owner = nullptr;
+        }
+    }
+    
+    StringConcat& operator=(StringConcat other) noexcept {
+        Swap(other);
+        return *this;
+    }
+    
+    ~StringConcat() {
+        for (const internal::ConcatPiece& piece : pieces) {
+            if (piece.owner) {
+                piece.owner->Release();
+            }
+        }
+    }
+    
+    int Length() const {
+        int total = 0;
+        for (const internal::ConcatPiece& piece : pieces) {
+            total += piece.length;
+        }
+        return total;
+    }
+    
+    String ToString() const { return String(*this); }
+    std::string ToUTF8() const { return ToString().ToUTF8(); }
+    std::string ToNarrow() const { return ToString().ToNarrow(); }
+    
+    friend bool operator==(const StringConcat& a, const String& b) { return a.ToString() == b; }
+    friend std::strong_ordering operator<=>(const StringConcat& a, const String& b) { return a.ToString() <=> b; }
+    
+    friend std::ostream& operator<<(std::ostream& os, const StringConcat& c) {
+        os << c.ToUTF8();
+        return os;
+    }
+};
+
+template<typename A, typename B>
+    requires internal::ConcatOperands<std::decay_t<A>, std::decay_t<B>>
+inline StringConcat<internal::ConcatCount<std::decay_t<A>>::value + internal::ConcatCount<std::decay_t<B>>::value>
+operator+(A&& a, B&& b) {
+    return { std::forward<A>(a), std::forward<B>(b) };
+}
+
 // ============================================================================
 // Array<T> - Dynamic array template with Pascal semantics
+// As in Delphi, a dynamic array is a reference to a refcounted buffer:
+// assignment and by-value parameters share it, element writes are seen
+// through every reference, and SetLength and Copy give a unique array
 // ============================================================================
+namespace internal {
+
+// Header of a dynamic array buffer; the elements follow it
+struct ArrayRec {
+    std::atomic<int> refCount;
+    int length;
+    int capacity;
+
+    explicit ArrayRec(int cap) : refCount(1), length(0), capacity(cap) {}
+};
+
+} // namespace internal
+
 template<typename T>
 class Array {
 private:
-    std::vector<T> data;
+    using Rec = internal::ArrayRec;
+
+    static constexpr std::size_t Align = alignof(T) > alignof(Rec) ? alignof(T) : alignof(Rec);
+    static constexpr std::size_t HeaderSize = (sizeof(Rec) + alignof(T) - 1) / alignof(T) * alignof(T);
+    static constexpr bool OverAligned = Align > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    // Elements that can be copied as bytes (numbers, Char, plain records)
+    static constexpr bool Trivial = std::is_trivially_copyable_v<T>;
+
+    Rec* rec = nullptr;
+
+    static T* Elements(Rec* r) {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(r) + HeaderSize);
+    }
+
+    static Rec* Allocate(int capacity) {
+        std::size_t bytes = HeaderSize + static_cast<std::size_t>(capacity) * sizeof(T);
+        void* mem;
+        if constexpr (OverAligned) {
+            mem = ::operator new(bytes, std::align_val_t(Align));
+        } else {
+            mem = ::operator new(bytes);
+        }
+        return new (mem) Rec(capacity);
+    }
+
+    static void Free(Rec* r) {
+        r->~Rec();
+        if constexpr (OverAligned) {
+            ::operator delete(r, std::align_val_t(Align));
+        } else {
+            ::operator delete(r);
+        }
+    }
+
+    static void Release(Rec* r) {
+        if (r && r->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::destroy_n(Elements(r), r->length);
+            Free(r);
+        }
+    }
+
+    // Amortized growth for repeated SetLength/Insert on a unique array
+    static int GrowCapacity(int current, int needed) {
+        int grown = current + current / 2;
+        return grown > needed ? grown : needed;
+    }
+
+    static void CopyConstruct(T* dst, const T* src, int count) {
+        if constexpr (Trivial) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(dst), src, static_cast<std::size_t>(count) * sizeof(T));
+            }
+        } else {
+            std::uninitialized_copy_n(src, count, dst);
+        }
+    }
+
+    // Copy-construct consecutive ranges one after another at dst; on a throw,
+    // destroy the elements already built
+    struct Piece {
+        const T* src;
+        int count;
+    };
+
+    static void CopyPieces(T* dst, const Piece* pieces, std::size_t n) {
+        int built = 0;
+        try {
+            for (std::size_t i = 0; i < n; i++) {
+                CopyConstruct(dst + built, pieces[i].src, pieces[i].count);
+                built += pieces[i].count;
+            }
+        } catch (...) {
+            std::destroy_n(dst, built);
+            throw;
+        }
+    }
+
+    // Allocate a buffer of 'length' elements and let 'init' construct them
+    // (the uninitialized_* algorithms clean up after themselves on a throw)
+    template<typename Init>
+    static Rec* Build(int length, int capacity, Init init) {
+        Rec* r = Allocate(capacity);
+        try {
+            init(Elements(r));
+        } catch (...) {
+            Free(r);
+            throw;
+        }
+        r->length = length;
+        return r;
+    }
+
+    // SetLength: 'fill' constructs the elements past the old length. A unique
+    // buffer is resized in place while it has room, and grows geometrically
+    // so that SetLength(A, Length(A) + 1) loops stay linear; a shared buffer
+    // is left to its other owners and the kept prefix is copied
+    template<typename Fill>
+    void Resize(int newlen, Fill fill) {
+        if (newlen <= 0) {
+            Release(rec);
+            rec = nullptr;
+            return;
+        }
+        int oldlen = Length();
+        bool unique = rec && rec->refCount.load(std::memory_order_acquire) == 1;
+        if (unique && newlen <= rec->capacity) {
+            if (newlen < oldlen) {
+                std::destroy(Elements(rec) + newlen, Elements(rec) + oldlen);
+            } else {
+                fill(Elements(rec) + oldlen, newlen - oldlen);
+            }
+            rec->length = newlen;
+            return;
+        }
+        int kept = oldlen < newlen ? oldlen : newlen;
+        int capacity = unique && newlen > oldlen ? GrowCapacity(rec->capacity, newlen) : newlen;
+        Rec* fresh;
+        if (!Trivial && std::is_nothrow_move_constructible_v<T> && unique) {
+            // Fill before moving so a throwing fill leaves the old elements intact
+            fresh = Build(newlen, capacity, [&](T* dst) {
+                fill(dst + kept, newlen - kept);
+                std::uninitialized_move_n(Elements(rec), kept, dst);
+            });
+        } else {
+            fresh = Build(newlen, capacity, [&](T* dst) {
+                CopyConstruct(dst, Elements(rec), kept);
+                try {
+                    fill(dst + kept, newlen - kept);
+                } catch (...) {
+                    std::destroy_n(dst, kept);
+                    throw;
+                }
+            });
+        }
+        Release(rec);
+        rec = fresh;
+    }
 
 public:
     Array() = default;
-    explicit Array(int size) : data(size) {}
-    Array(int size, const T& initial_value) : data(size, initial_value) {}
+
+    explicit Array(int size) {
+        if (size > 0) {
+            rec = Build(size, size, [&](T* dst) { std::uninitialized_value_construct_n(dst, size); });
+        }
+    }
+
+    Array(int size, const T& initial_value) {
+        if (size > 0) {
+            rec = Build(size, size, [&](T* dst) { std::uninitialized_fill_n(dst, size, initial_value); });
+        }
+    }
+
+    // A new unique array holding copies of count elements
+    Array(const T* first, int count) {
+        if (count > 0) {
+            rec = Build(count, count, [&](T* dst) { CopyConstruct(dst, first, count); });
+        }
+    }
+
+    // Concat: one allocation for all the parts
+    template<typename... Parts>
+        requires (std::same_as<Parts, Array> && ...)
+    static Array Join(const Parts&... parts) {
+        Array result;
+        int total = (0 + ... + parts.Length());
+        if (total > 0) {
+            Piece pieces[] = { Piece{ parts.Data(), parts.Length() }... };
+            result.rec = Build(total, total, [&](T* dst) { CopyPieces(dst, pieces, sizeof...(Parts)); });
+        }
+        return result;
+    }
+
+    // Sharing: copies only move the reference count
+    Array(const Array& other) noexcept : rec(other.rec) {
+        if (rec) {
+            rec->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    Array(Array&& other) noexcept : rec(other.rec) {
+        other.rec = nullptr;
+    }
+
+    Array& operator=(const Array& other) noexcept {
+        if (other.rec) {
+            other.rec->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        Release(rec);
+        rec = other.rec;
+        return *this;
+    }
+
+    Array& operator=(Array&& other) noexcept {
+        if (this != &other) {
+            Release(rec);
+            rec = other.rec;
+            other.rec = nullptr;
+        }
+        return *this;
+    }
+
+    ~Array() {
+        Release(rec);
+    }
     
-    // Element access (0-based - Pascal dynamic arrays are 0-based)
+    // Element access (0-based - Pascal dynamic arrays are 0-based).
+    // Writes go to the shared buffer, as in Delphi
     T& operator[](int index) {
-        return data[index];
+        internal::CheckIndex(index, Length());
+        return Elements(rec)[index];
     }
     
     const T& operator[](int index) const {
-        return data[index];
+        internal::CheckIndex(index, Length());
+        return Elements(rec)[index];
     }
     
     // Overloads for wrapped integer types (implicit conversion support)
     T& operator[](const Integer& index) {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
     }
     
     const T& operator[](const Integer& index) const {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
     }
     
     T& operator[](const Int64& index) {
-        return data[static_cast<int>(index.ToInt64())];
+        return (*this)[static_cast<int>(index.ToInt64())];
     }
     
     const T& operator[](const Int64& index) const {
-        return data[static_cast<int>(index.ToInt64())];
+        return (*this)[static_cast<int>(index.ToInt64())];
     }
     
     T& operator[](const Cardinal& index) {
-        return data[static_cast<int>(index.ToCardinal())];
+        return (*this)[static_cast<int>(index.ToCardinal())];
     }
     
     const T& operator[](const Cardinal& index) const {
-        return data[static_cast<int>(index.ToCardinal())];
+        return (*this)[static_cast<int>(index.ToCardinal())];
     }
     
     T& operator[](const Byte& index) {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
     }
     
     const T& operator[](const Byte& index) const {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
     }
     
     T& operator[](const Word& index) {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
     }
     
     const T& operator[](const Word& index) const {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
     }
     
     T& operator[](const ShortInt& index) {
-        return data[index.ToInt()];
+        return (*this)[index.ToInt()];
+    }
+    
+    const T& operator[](const ShortInt& index) const {
+        return (*this)[index.ToInt()];
+    }
+    
+    T& operator[](const SmallInt& index) {
+        return (*this)[index.ToInt()];
+    }
+    
+    const T& operator[](const SmallInt& index) const {
+        return (*this)[index.ToInt()];
+    }
+    
+    T& operator[](const UInt64& index) {
+        return (*this)[static_cast<int>(index.ToUInt64())];
+    }
+    
+    const T& operator[](const UInt64& index) const {
+        return (*this)[static_cast<int>(index.ToUInt64())];
+    }
+    
+    // Array properties
+    int Length() const { return rec ? rec->length : 0; }
+    int High() const { return Length() - 1; }
+    int Low() const { return 0; }
+    
+    // Resize (always leaves this array unique)
+    void SetLength(int newlen) {
+        Resize(newlen, [](T* dst, int n) { std::uninitialized_value_construct_n(dst, n); });
+    }
+    
+    void SetLength(int newlen, const T& value) {
+        Resize(newlen, [&](T* dst, int n) { std::uninitialized_fill_n(dst, n, value); });
+    }
+
+    // Delphi Delete: remove 'count' elements at 0-based 'index' (nothing if the
+    // index is out of range). A unique array is shifted in place; a shared one
+    // is copied around the gap
+    void Delete(int index, int count) {
+        int oldlen = Length();
+        if (index < 0 || index >= oldlen || count <= 0) {
+            return;
+        }
+        if (count > oldlen - index) {
+            count = oldlen - index;
+        }
+        int newlen = oldlen - count;
+        if (newlen == 0) {
+            Release(rec);
+            rec = nullptr;
+            return;
+        }
+        T* elems = Elements(rec);
+        if (rec->refCount.load(std::memory_order_acquire) != 1) {
+            Piece pieces[] = { { elems, index }, { elems + index + count, newlen - index } };
+            Rec* fresh = Build(newlen, newlen, [&](T* dst) { CopyPieces(dst, pieces, 2); });
+            Release(rec);
+            rec = fresh;
+            return;
+        }
+        if constexpr (Trivial) {
+            std::memmove(static_cast<void*>(elems + index), elems + index + count,
+                         static_cast<std::size_t>(newlen - index) * sizeof(T));
+        } else {
+            std::move(elems + index + count, elems + oldlen, elems + index);
+            std::destroy(elems + newlen, elems + oldlen);
+        }
+        rec->length = newlen;
+    }
+
+    // Delphi Insert: insert 'count' elements before 0-based 'index' (clamped
+    // to 0..Length). A unique array with room shifts its tail in place
+    void Insert(int index, const T* src, int count) {
+        if (count <= 0) {
+            return;
+        }
+        int oldlen = Length();
+        if (index < 0) {
+            index = 0;
+        } else if (index > oldlen) {
+            index = oldlen;
+        }
+        int newlen = oldlen + count;
+        T* elems = Data();
+        bool unique = rec && rec->refCount.load(std::memory_order_acquire) == 1;
+        bool aliased = elems && std::less_equal<const T*>()(elems, src) && std::less<const T*>()(src, elems + oldlen);
+        constexpr bool Relocatable = Trivial || std::is_nothrow_move_constructible_v<T>;
+        if constexpr (Relocatable) {
+            if (unique && !aliased && newlen <= rec->capacity) {
+                if constexpr (Trivial) {
+                    std::memmove(static_cast<void*>(elems + index + count), elems + index,
+                                 static_cast<std::size_t>(oldlen - index) * sizeof(T));
+                    std::memcpy(static_cast<void*>(elems + index), src, static_cast<std::size_t>(count) * sizeof(T));
+                } else {
+                    // Build the new elements past the end (the only step that
+                    // can throw), then rotate them into place
+                    std::uninitialized_copy_n(src, count, elems + oldlen);
+                    std::rotate(elems + index, elems + oldlen, elems + newlen);
+                }
+                rec->length = newlen;
+                return;
+            }
+        }
+        // Spare room only helps types that can use the in-place path above
+        int capacity = unique && Relocatable ? GrowCapacity(rec->capacity, newlen) : newlen;
+        Rec* fresh;
+        if constexpr (!Trivial && Relocatable) {
+            if (unique && !aliased) {
+                // Only the new elements can throw; the old ones are moved over
+                fresh = Build(newlen, capacity, [&](T* dst) {
+                    CopyConstruct(dst + index, src, count);
+                    std::uninitialized_move_n(elems, index, dst);
+                    std::uninitialized_move_n(elems + index, oldlen - index, dst + index + count);
+                });
+                Release(rec);
+                rec = fresh;
+                return;
+            }
+        }
+        // Build the new buffer before releasing the old one: 'src' may point into it
+        Piece pieces[] = { { elems, index }, { src, count }, { elems + index, oldlen - index } };
+        fresh = Build(newlen, capacity, [&](T* dst) { CopyPieces(dst, pieces, 3); });
+        Release(rec);
+        rec = fresh;
+    }
+
+    // Number of Array references sharing the buffer (0 for an empty array)
+    int RefCount() const { return rec ? rec->refCount.load(std::memory_order_relaxed) : 0; }
+    
+    // Element storage
+    T* Data() { return rec ? Elements(rec) : nullptr; }
+    const T* Data() const { return rec ? Elements(rec) : nullptr; }
+    T* begin() { return Data(); }
+    T* end() { return Data() + Length(); }
+    const T* begin() const { return Data(); }
+    const T* end() const { return Data() + Length(); }
+    
+    // Element-wise comparison (a shared buffer is trivially equal)
+    bool operator==(const Array<T>& other) const {
+        return rec == other.rec || std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+    auto operator<=>(const Array<T>& other) const {
+        return std::lexicographical_compare_three_way(begin(), end(), other.begin(), other.end());
+    }
+};
+
+// ============================================================================
+// Matrix<T> - Dense rectangular 2-D dynamic array (TMatrix<T>)
+// One row-major buffer (an Array<T>, so copies share it and SetLength makes
+// it unique) instead of one allocation per row. M[i][j] goes through a row
+// view, M(i, j) indexes directly; both are a multiply-add on the row stride
+// ============================================================================
+namespace internal {
+
+inline int MatrixIndex(int i) { return i; }
+inline int MatrixIndex(const Integer& i) { return i.ToInt(); }
+inline int MatrixIndex(const Int64& i) { return static_cast<int>(i.ToInt64()); }
+inline int MatrixIndex(const Cardinal& i) { return static_cast<int>(i.ToCardinal()); }
+inline int MatrixIndex(const Byte& i) { return i.ToInt(); }
+inline int MatrixIndex(const Word& i) { return i.ToInt(); }
+inline int MatrixIndex(const ShortInt& i) { return i.ToInt(); }
+inline int MatrixIndex(const SmallInt& i) { return i.ToInt(); }
+inline int MatrixIndex(const UInt64& i) { return static_cast<int>(i.ToUInt64()); }
+
+template<typename I>
+concept MatrixIndexType = requires(const I& i) { MatrixIndex(i); };
+
+// Rows * Cols as an element count (an Array length); a product beyond
+// MaxInt raises EOverflow instead of wrapping
+inline int MatrixSize(int rows, int cols) {
+    int size;
+    if (__builtin_mul_overflow(rows, cols, &size)) [[unlikely]] {
+        RaiseOverflowError();
+    }
+    return size;
+}
+
+} // namespace internal
+
+// One row of a Matrix (T is const for rows of a const Matrix)
+template<typename T>
+class MatrixRow {
+private:
+    T* elems;
+    int count;
+
+public:
+    MatrixRow(T* e, int n) : elems(e), count(n) {}
+
+    template<internal::MatrixIndexType I>
+    T& operator[](const I& index) const {
+        int i = internal::MatrixIndex(index);
+        internal::CheckIndex(i, count);
+        return elems[i];
+    }
+
+    int Length() const { return count; }
+    int High() const { return count - 1; }
+    int Low() const { return 0; }
+
+    T* Data() const { return elems; }
+    T* begin() const { return elems; }
+    T* end() const { return elems + count; }
+};
+
+template<typename T>
+class Matrix {
+private:
+    Array<T> data;
+    int rows = 0;
+    int cols = 0;
+
+    std::size_t Offset(int i, int j) const {
+        return static_cast<std::size_t>(i) * static_cast<std::size_t>(cols) + static_cast<std::size_t>(j);
+    }
+
+public:
+    Matrix() = default;
+
+    Matrix(int r, int c) {
+        SetLength(r, c);
     }
-    
-    const T& operator[](const ShortInt& index) const {
-        return data[index.ToInt()];
+
+    Matrix(int r, int c, const T& value) : data(r > 0 && c > 0 ? internal::MatrixSize(r, c) : 0, value) {
+        if (data.Length() > 0) {
+            rows = r;
+            cols = c;
+        }
     }
-    
-    T& operator[](const SmallInt& index) {
-        return data[index.ToInt()];
+
+    // Element access: M[i][j] (Pascal M[i, j]) and M(i, j). The row is
+    // checked here, the column by the MatrixRow
+    template<internal::MatrixIndexType I>
+    MatrixRow<T> operator[](const I& row) {
+        int i = internal::MatrixIndex(row);
+        internal::CheckIndex(i, rows);
+        return MatrixRow<T>(data.Data() + Offset(i, 0), cols);
     }
-    
-    const T& operator[](const SmallInt& index) const {
-        return data[index.ToInt()];
+
+    template<internal::MatrixIndexType I>
+    MatrixRow<const T> operator[](const I& row) const {
+        int i = internal::MatrixIndex(row);
+        internal::CheckIndex(i, rows);
+        return MatrixRow<const T>(data.Data() + Offset(i, 0), cols);
     }
-    
-    T& operator[](const UInt64& index) {
-        return data[static_cast<int>(index.ToUInt64())];
+
+    template<internal::MatrixIndexType I, internal::MatrixIndexType J>
+    T& operator()(const I& row, const J& col) {
+        int i = internal::MatrixIndex(row);
+        int j = internal::MatrixIndex(col);
+        internal::CheckIndex(i, rows);
+        internal::CheckIndex(j, cols);
+        return data.Data()[Offset(i, j)];
     }
-    
-    const T& operator[](const UInt64& index) const {
-        return data[static_cast<int>(index.ToUInt64())];
+
+    template<internal::MatrixIndexType I, internal::MatrixIndexType J>
+    const T& operator()(const I& row, const J& col) const {
+        int i = internal::MatrixIndex(row);
+        int j = internal::MatrixIndex(col);
+        internal::CheckIndex(i, rows);
+        internal::CheckIndex(j, cols);
+        return data.Data()[Offset(i, j)];
     }
-    
-    // Array properties
-    int Length() const { return static_cast<int>(data.size()); }
-    int High() const { return static_cast<int>(data.size()) - 1; }
+
+    // Bounds: Length/High of the matrix are those of the first dimension,
+    // Length(dim)/High(dim) give either one (0 = rows, 1 = columns)
+    int Length() const { return rows; }
+    int High() const { return rows - 1; }
     int Low() const { return 0; }
-    
-    // Resize
-    void SetLength(int newlen) {
-        data.resize(newlen);
+    int Length(int dim) const { return dim == 0 ? rows : cols; }
+    int High(int dim) const { return Length(dim) - 1; }
+    int Rows() const { return rows; }
+    int Cols() const { return cols; }
+
+    // SetLength(M, Rows, Cols): keeps the overlapping block, new elements are
+    // zero/default, and the matrix is left unique (as with Array). There is
+    // no SetLength(M, Rows): a matrix always has both dimensions
+    void SetLength(int r, int c) {
+        if (r <= 0 || c <= 0) {
+            data.SetLength(0);
+            rows = 0;
+            cols = 0;
+            return;
+        }
+        int size = internal::MatrixSize(r, c);
+        if (c == cols || rows == 0) {
+            // Same row layout: the kept rows are a prefix of the buffer
+            data.SetLength(size);
+        } else {
+            Array<T> fresh(size);
+            int keepRows = r < rows ? r : rows;
+            int keepCols = c < cols ? c : cols;
+            for (int i = 0; i < keepRows; i++) {
+                std::copy_n(data.Data() + Offset(i, 0), keepCols,
+                            fresh.Data() + static_cast<std::size_t>(i) * static_cast<std::size_t>(c));
+            }
+            data = std::move(fresh);
+        }
+        rows = r;
+        cols = c;
     }
-    
-    void SetLength(int newlen, const T& value) {
-        data.resize(newlen, value);
+
+    // The elements in row-major order
+    T* Data() { return data.Data(); }
+    const T* Data() const { return data.Data(); }
+    T* begin() { return data.begin(); }
+    T* end() { return data.end(); }
+    const T* begin() const { return data.begin(); }
+    const T* end() const { return data.end(); }
+
+    int RefCount() const { return data.RefCount(); }
+
+    bool operator==(const Matrix<T>& other) const {
+        return rows == other.rows && cols == other.cols && data == other.data;
     }
-    
-    // Access internal vector if needed
-    std::vector<T>& GetVector() { return data; }
-    const std::vector<T>& GetVector() const { return data; }
-    
-    auto operator<=>(const Array<T>& other) const = default;
-    bool operator==(const Array<T>& other) const = default;
 };
 
 // ============================================================================
@@ -1618,203 +3393,680 @@ public:
 // ============================================================================
 template<typename T, std::size_t N>
 class StaticArray : public std::array<T, N> {
+private:
+    static constexpr std::size_t Checked(std::size_t index) {
+        internal::CheckIndex(static_cast<int>(index), static_cast<int>(N));
+        return index;
+    }
+
 public:
-    using std::array<T, N>::operator[];  // Inherit base operator[]
+    constexpr T& operator[](std::size_t index) {
+        return std::array<T, N>::operator[](Checked(index));
+    }
+    
+    constexpr const T& operator[](std::size_t index) const {
+        return std::array<T, N>::operator[](Checked(index));
+    }
     
     // Overloads for wrapped integer types (implicit conversion support)
     T& operator[](const Integer& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     const T& operator[](const Integer& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     T& operator[](const Int64& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt64()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt64())));
     }
     
     const T& operator[](const Int64& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt64()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt64())));
     }
     
     T& operator[](const Cardinal& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToCardinal()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToCardinal())));
     }
     
     const T& operator[](const Cardinal& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToCardinal()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToCardinal())));
     }
     
     T& operator[](const Byte& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     const T& operator[](const Byte& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     T& operator[](const Word& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     const T& operator[](const Word& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     T& operator[](const ShortInt& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     const T& operator[](const ShortInt& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     T& operator[](const SmallInt& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     const T& operator[](const SmallInt& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToInt()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToInt())));
     }
     
     T& operator[](const UInt64& index) {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToUInt64()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToUInt64())));
     }
     
     const T& operator[](const UInt64& index) const {
-        return std::array<T, N>::operator[](static_cast<std::size_t>(index.ToUInt64()));
+        return std::array<T, N>::operator[](Checked(static_cast<std::size_t>(index.ToUInt64())));
+    }
+};
+
+// ============================================================================
+// OpenArray<T> - Non-owning view for open array parameters (array of T)
+// A pointer and a count, like std::span. `const A: array of T` becomes
+// OpenArray<const T>, `var A: array of T` OpenArray<T>, and a by-value
+// `A: array of T` an OpenArrayCopy<T> (below). Dynamic arrays, static arrays,
+// matrix rows and array literals bind to it without copying their elements
+// ============================================================================
+template<typename T>
+class OpenArray {
+private:
+    T* elems = nullptr;
+    int count = 0;
+
+    using Element = std::remove_const_t<T>;
+
+    // U elements can be viewed as T (same type, or adding const)
+    template<typename U>
+    static constexpr bool Binds = std::is_convertible_v<U(*)[], T(*)[]>;
+
+public:
+    OpenArray() = default;
+    OpenArray(T* e, int n) : elems(e), count(n) {}
+
+    template<typename U> requires Binds<U>
+    OpenArray(Array<U>& a) : elems(a.Data()), count(a.Length()) {}
+
+    template<typename U> requires Binds<const U>
+    OpenArray(const Array<U>& a) : elems(a.Data()), count(a.Length()) {}
+
+    template<typename U, std::size_t N> requires Binds<U>
+    OpenArray(StaticArray<U, N>& a) : elems(a.data()), count(static_cast<int>(N)) {}
+
+    template<typename U, std::size_t N> requires Binds<const U>
+    OpenArray(const StaticArray<U, N>& a) : elems(a.data()), count(static_cast<int>(N)) {}
+
+    template<typename U> requires Binds<U>
+    OpenArray(const MatrixRow<U>& row) : elems(row.Data()), count(row.Length()) {}
+
+    template<typename U> requires Binds<U>
+    OpenArray(const OpenArray<U>& other) : elems(other.Data()), count(other.Length()) {}
+
+    // Braced list from C++ code; valid for the full-expression of the call
+    OpenArray(std::initializer_list<Element> list) requires std::is_const_v<T>
+        : elems(list.begin()), count(static_cast<int>(list.size())) {}
+
+    template<internal::MatrixIndexType I>
+    T& operator[](const I& index) const {
+        int i = internal::MatrixIndex(index);
+        internal::CheckIndex(i, count);
+        return elems[i];
     }
+
+    int Length() const { return count; }
+    int High() const { return count - 1; }
+    int Low() const { return 0; }
+
+    T* Data() const { return elems; }
+    T* begin() const { return elems; }
+    T* end() const { return elems + count; }
+};
+
+namespace internal {
+
+// Holds the copy an OpenArrayCopy views; a base class so that it is built
+// before the OpenArray base
+template<typename T>
+struct OpenArrayStorage {
+    Array<T> items;
+};
+
+} // namespace internal
+
+// ============================================================================
+// OpenArrayCopy<T> - By-value open array parameter (A: array of T)
+// As in Delphi the routine gets its own writable copy of the argument, so
+// A[I] := X stays local. It is an OpenArray<T> over that copy, so Length,
+// High, indexing and passing it on work as for any open array. Use const
+// parameters to avoid the copy
+// ============================================================================
+template<typename T>
+class OpenArrayCopy : private internal::OpenArrayStorage<T>, public OpenArray<T> {
+private:
+    using Storage = internal::OpenArrayStorage<T>;
+
+    explicit OpenArrayCopy(OpenArray<const T> source)
+        : Storage{Array<T>(source.Data(), source.Length())},
+          OpenArray<T>(Storage::items.Data(), Storage::items.Length()) {}
+
+public:
+    template<typename U> requires std::is_constructible_v<OpenArray<const T>, const U&>
+    OpenArrayCopy(const U& source) : OpenArrayCopy(OpenArray<const T>(source)) {}
+
+    OpenArrayCopy(std::initializer_list<T> list) : OpenArrayCopy(OpenArray<const T>(list)) {}
+
+    OpenArrayCopy(const OpenArrayCopy& other) : OpenArrayCopy(OpenArray<const T>(other)) {}
+    OpenArrayCopy& operator=(const OpenArrayCopy&) = delete;
 };
 
+// Array literal passed to an open array parameter of element type T:
+// F([1, 2.5]) -> F(bp::MakeArray<Double>(1, 2.5)). The elements live in a
+// temporary on the caller's stack until the end of the call's full-expression
+template<typename T, typename... E> requires (std::is_convertible_v<const E&, T> && ...)
+inline constexpr StaticArray<T, sizeof...(E)> MakeArray(const E&... elements) {
+    return StaticArray<T, sizeof...(E)>{{static_cast<T>(elements)...}};
+}
+
 // ============================================================================
-// Set - Wraps std::bitset with Pascal set semantics
-// Template parameters Low and High define the set range (currently unused,
-// but required for transpiler compatibility: bp::Set<0, 9>)
+// Set - Pascal set of Low..High
+// Storage is picked from the range at compile time: a single 8, 16, 32 or
+// 64-bit word when the range has up to 64 elements, an array of 64-bit words
+// otherwise. Bit i stands for element Low + i and bits past High stay zero,
+// so union, intersection, difference and 'in' on a small set are one or two
+// instructions. A 5-element enum set takes 1 byte; set of 0..255 takes 32
 // ============================================================================
+namespace internal {
+
+template<int Count>
+using SetWord = std::conditional_t<Count <= 8, std::uint8_t,
+                std::conditional_t<Count <= 16, std::uint16_t,
+                std::conditional_t<Count <= 32, std::uint32_t, std::uint64_t>>>;
+
+} // namespace internal
+
 template<int Low = 0, int High = 255>
 class Set {
+    static_assert(Low <= High, "bp::Set needs Low <= High");
+
+    template<int L, int H> friend class Set;
+
+public:
+    static constexpr int Count = High - Low + 1;
+
 private:
-    std::bitset<256> bits;
+    using Word = internal::SetWord<Count>;
+    static constexpr int WordBits = static_cast<int>(sizeof(Word) * 8);
+    static constexpr int Words = (Count + WordBits - 1) / WordBits;
+
+    Word words[Words] = {};
+
+    static constexpr bool InRange(int element) {
+        return element >= Low && element <= High;
+    }
+
+    static constexpr Word BitOf(int index) {
+        return static_cast<Word>(Word(1) << (index % WordBits));
+    }
+
+    // Bits of word k that fall inside the range
+    static constexpr Word RangeMask(int k) {
+        int bits = Count - k * WordBits;
+        return bits >= WordBits ? static_cast<Word>(~Word(0)) : static_cast<Word>((Word(1) << bits) - 1);
+    }
+
+    // n bits starting at bit 'first' (n <= 64, 'first' a multiple of n)
+    constexpr std::uint64_t BitsAt(int first, int n) const {
+        if (n >= WordBits) {
+            std::uint64_t r = 0;
+            for (int j = 0; j < n / WordBits; j++) {
+                int k = first / WordBits + j;
+                if (k < Words) r |= static_cast<std::uint64_t>(words[k]) << (j * WordBits);
+            }
+            return r;
+        }
+        int k = first / WordBits;
+        if (k >= Words) return 0;
+        return (static_cast<std::uint64_t>(words[k]) >> (first % WordBits)) & ((std::uint64_t(1) << n) - 1);
+    }
+
+    // Calls f(element) for each member, in ascending order
+    template<typename F>
+    constexpr void ForEachMember(F&& f) const {
+        for (int k = 0; k < Words; k++) {
+            Word w = words[k];
+            while (w) {
+                f(Low + k * WordBits + std::countr_zero(w));
+                w = static_cast<Word>(w & (w - 1));
+            }
+        }
+    }
 
 public:
-    Set() = default;
-    
-    // Include/Exclude
-    void Include(int element) {
-        if (element >= 0 && element < 256)
-            bits.set(element);
+    constexpr Set() = default;
+
+    // Conversion from a set over another range, including set literals
+    // (Set<0, 255>). With the same Low the words are copied; otherwise the
+    // members are re-inserted. A member outside Low..High raises ERangeError
+    // under BP_RANGECHECKS (found by comparing the member counts, so an
+    // in-range set costs two popcounts) and is dropped otherwise
+    template<int L, int H> requires (L != Low || H != High)
+    constexpr Set(const Set<L, H>& other) {
+        if constexpr (L == Low) {
+            for (int k = 0; k < Words; k++)
+                words[k] = static_cast<Word>(other.BitsAt(k * WordBits, WordBits)) & RangeMask(k);
+        } else {
+            other.ForEachMember([this](int element) { Include(element); });
+        }
+#if defined(BP_RANGECHECKS)
+        if constexpr (L < Low || H > High) {
+            if (Cardinality() != other.Cardinality()) [[unlikely]] {
+                other.ForEachMember([](int element) {
+                    if (!InRange(element))
+                        internal::RaiseRangeError(element, Low, High);
+                });
+            }
+        }
+#endif
     }
-    
-    void Exclude(int element) {
-        if (element >= 0 && element < 256)
-            bits.reset(element);
+
+    // Include/Exclude
+    constexpr void Include(int element) {
+        if (InRange(element)) {
+            int i = element - Low;
+            words[i / WordBits] |= BitOf(i);
+        }
     }
-    
-    // Test membership (Pascal 'in' operator)
-    bool Contains(int element) const {
-        if (element >= 0 && element < 256)
-            return bits.test(element);
-        return false;
+
+    constexpr void Exclude(int element) {
+        if (InRange(element)) {
+            int i = element - Low;
+            words[i / WordBits] &= static_cast<Word>(~BitOf(i));
+        }
     }
-    
-    // Set operators
-    Set operator+(const Set& other) const {
-        Set result;
-        result.bits = bits | other.bits;
-        return result;
+
+    // Include every element of low..high (clipped to the range) a word at a time
+    constexpr void IncludeRange(int low, int high) {
+        if (low < Low) low = Low;
+        if (high > High) high = High;
+        if (low > high) return;
+        int first = low - Low;
+        int last = high - Low;
+        for (int k = first / WordBits; k <= last / WordBits; k++) {
+            int from = k == first / WordBits ? first % WordBits : 0;
+            int to = k == last / WordBits ? last % WordBits : WordBits - 1;
+            Word upTo = to + 1 >= WordBits ? static_cast<Word>(~Word(0)) : static_cast<Word>((Word(1) << (to + 1)) - 1);
+            words[k] |= static_cast<Word>(upTo & static_cast<Word>(static_cast<Word>(~Word(0)) << from));
+        }
     }
-    
-    Set operator*(const Set& other) const {
-        Set result;
-        result.bits = bits & other.bits;
-        return result;
+
+    // Test membership (Pascal 'in' operator)
+    constexpr bool Contains(int element) const& {
+        if (!InRange(element)) return false;
+        int i = element - Low;
+        return (words[i / WordBits] & BitOf(i)) != 0;
     }
-    
-    Set operator-(const Set& other) const {
-        Set result;
-        result.bits = bits & ~other.bits;
-        return result;
+
+    // On a set computed in the expression itself (a literal such as
+    // ['_', 'a'..'z']) the word is picked with constant indices only. The
+    // compiler then keeps the words in registers and, when they are
+    // constants, folds the test to an immediate mask instead of building the
+    // set on the stack
+    constexpr bool Contains(int element) && {
+        if (!InRange(element)) return false;
+        int i = element - Low;
+        if constexpr (Words == 1) {
+            return (words[0] & BitOf(i)) != 0;
+        } else {
+            int q = i / WordBits;
+            Word w = [&]<int... K>(std::integer_sequence<int, K...>) {
+                return static_cast<Word>(((words[K] & static_cast<Word>(Word(0) - Word(K == q))) | ...));
+            }(std::make_integer_sequence<int, Words>());
+            return (w & BitOf(i)) != 0;
+        }
     }
-    
-    // Comparison operators - manual implementation since std::bitset doesn't support <=>
-    bool operator==(const Set& other) const {
-        return bits == other.bits;
+
+    constexpr bool IsEmpty() const {
+        for (int k = 0; k < Words; k++)
+            if (words[k]) return false;
+        return true;
     }
-    
-    bool operator!=(const Set& other) const {
-        return bits != other.bits;
+
+    // Number of members (popcount of each word)
+    constexpr int Cardinality() const {
+        int n = 0;
+        for (int k = 0; k < Words; k++) n += std::popcount(words[k]);
+        return n;
     }
-    
-    bool operator<(const Set& other) const {
-        // Lexicographic comparison of bitsets
-        for (int i = 255; i >= 0; --i) {
-            if (bits[i] != other.bits[i]) {
-                return other.bits[i];  // true if other has bit, this doesn't
+
+    // Members in ascending order (for X in S). The iterator keeps the
+    // unvisited bits of the current word: countr_zero finds the next member
+    // and w & (w - 1) clears it, so empty stretches cost one test per word
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = int;
+
+        constexpr Iterator() = default;
+
+        constexpr int operator*() const {
+            return Low + k * WordBits + std::countr_zero(w);
+        }
+
+        constexpr Iterator& operator++() {
+            w = static_cast<Word>(w & (w - 1));
+            SkipEmpty();
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        constexpr bool operator==(const Iterator& other) const {
+            return k == other.k && w == other.w;
+        }
+
+    private:
+        friend class Set;
+
+        const Word* words = nullptr;
+        int k = Words;
+        Word w = 0;
+
+        constexpr Iterator(const Word* words, int k) : words(words), k(k), w(k < Words ? words[k] : 0) {
+            SkipEmpty();
+        }
+
+        constexpr void SkipEmpty() {
+            while (w == 0 && k < Words) {
+                if (++k < Words) w = words[k];
             }
         }
-        return false;  // Equal sets
+    };
+
+    constexpr Iterator begin() const { return Iterator(words, 0); }
+    constexpr Iterator end() const { return Iterator(words, Words); }
+
+    // Set operators: + union, * intersection, - difference
+    constexpr Set& operator+=(const Set& other) {
+        for (int k = 0; k < Words; k++) words[k] |= other.words[k];
+        return *this;
     }
-    
-    bool operator<=(const Set& other) const {
-        return !(other < *this);
+
+    constexpr Set& operator*=(const Set& other) {
+        for (int k = 0; k < Words; k++) words[k] &= other.words[k];
+        return *this;
     }
-    
-    bool operator>(const Set& other) const {
-        return other < *this;
+
+    constexpr Set& operator-=(const Set& other) {
+        for (int k = 0; k < Words; k++) words[k] &= static_cast<Word>(~other.words[k]);
+        return *this;
     }
-    
-    bool operator>=(const Set& other) const {
-        return !(*this < other);
+
+    constexpr bool operator==(const Set& other) const {
+        for (int k = 0; k < Words; k++)
+            if (words[k] != other.words[k]) return false;
+        return true;
     }
-    
-    // Subset/Superset
-    bool IsSubsetOf(const Set& other) const {
-        return (bits & ~other.bits).none();
+
+    // Pascal's A <= B (subset) and A >= B (superset)
+    template<int L, int H>
+    constexpr bool IsSubsetOf(const Set<L, H>& other) const {
+        if constexpr (L == Low && H == High) {
+            for (int k = 0; k < Words; k++)
+                if (words[k] & ~other.words[k]) return false;
+            return true;
+        } else {
+            using Common = Set<(Low < L ? Low : L), (High > H ? High : H)>;
+            return Common(*this).IsSubsetOf(Common(other));
+        }
     }
-    
-    bool IsSupersetOf(const Set& other) const {
-        return (other.bits & ~bits).none();
+
+    template<int L, int H>
+    constexpr bool IsSupersetOf(const Set<L, H>& other) const {
+        return other.IsSubsetOf(*this);
+    }
+
+    // Total order for use as a sorted container key: the set whose highest
+    // differing element belongs to it is the greater one
+    constexpr bool Less(const Set& other) const {
+        for (int k = Words - 1; k >= 0; k--)
+            if (words[k] != other.words[k]) return words[k] < other.words[k];
+        return false;
+    }
+
+    // Hash of the members (std::hash<bp::Set>)
+    std::size_t Hash() const {
+        return static_cast<std::size_t>(simd::HashBytes(words, sizeof(words)));
     }
 };
 
+// Operands of different ranges (a set variable and a literal, say) meet in
+// the smallest range covering both; equal ranges work on the words directly
+namespace internal {
+
+template<int L1, int H1, int L2, int H2>
+using CommonSet = Set<(L1 < L2 ? L1 : L2), (H1 > H2 ? H1 : H2)>;
+
+// A one-character string literal: the transpiler emits 'a' as L"a"
+template<typename X>
+inline constexpr bool IsCharLiteral = std::is_array_v<X> && std::extent_v<X> == 2 &&
+    (std::is_same_v<std::remove_cv_t<std::remove_extent_t<X>>, wchar_t> ||
+     std::is_same_v<std::remove_cv_t<std::remove_extent_t<X>>, char>);
+
+// Anything that names a set element: integers, enumerations, Char, the
+// integer wrappers and character literals
+template<typename X>
+inline constexpr bool IsSetElement = IsCharLiteral<X> ||
+    (!std::is_floating_point_v<X> && std::is_constructible_v<int, const X&>);
+
+template<typename X>
+inline constexpr int SetOrdinal(const X& element) {
+    if constexpr (IsCharLiteral<X>)
+        return static_cast<int>(element[0]);
+    else
+        return static_cast<int>(element);
+}
+
+} // namespace internal
+
+template<int L1, int H1, int L2, int H2>
+inline constexpr internal::CommonSet<L1, H1, L2, H2> operator+(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    internal::CommonSet<L1, H1, L2, H2> result(a);
+    result += internal::CommonSet<L1, H1, L2, H2>(b);
+    return result;
+}
+
+// a * b and a - b hold only elements of a, so they keep a's range
+template<int L1, int H1, int L2, int H2>
+inline constexpr Set<L1, H1> operator*(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    Set<L1, H1> result(a);
+    result *= Set<L1, H1>(b);
+    return result;
+}
+
+template<int L1, int H1, int L2, int H2>
+inline constexpr Set<L1, H1> operator-(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    Set<L1, H1> result(a);
+    result -= Set<L1, H1>(b);
+    return result;
+}
+
+template<int L1, int H1, int L2, int H2> requires (L1 != L2 || H1 != H2)
+inline constexpr bool operator==(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    using Common = internal::CommonSet<L1, H1, L2, H2>;
+    return Common(a) == Common(b);
+}
+
+template<int L1, int H1, int L2, int H2>
+inline constexpr bool operator<=(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    return a.IsSubsetOf(b);
+}
+
+template<int L1, int H1, int L2, int H2>
+inline constexpr bool operator>=(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    return a.IsSupersetOf(b);
+}
+
+template<int L1, int H1, int L2, int H2>
+inline constexpr bool operator<(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    using Common = internal::CommonSet<L1, H1, L2, H2>;
+    return Common(a).Less(Common(b));
+}
+
+template<int L1, int H1, int L2, int H2>
+inline constexpr bool operator>(const Set<L1, H1>& a, const Set<L2, H2>& b) {
+    return b < a;
+}
+
 // Set construction helpers
 template<int Low = 0, int High = 255>
-inline Set<Low, High> MakeSet(std::initializer_list<int> elements) {
+inline constexpr Set<Low, High> MakeSet(std::initializer_list<int> elements) {
     Set<Low, High> s;
     for (int e : elements) s.Include(e);
     return s;
 }
 
-template<int Low = 0, int High = 255>
-inline Set<Low, High> MakeSetRange(int low, int high) {
+// [a, b, c] whose target the transpiler cannot resolve (a runtime function
+// such as SumInt([1, 2]), an overloaded routine) may be a set or an array
+// literal. SetLiteral is a Set that also keeps a copy of its elements, in
+// order. Converting the temporary to OpenArray<const T> builds the T values in
+// its own stack slots (heap for large T), which live until the end of the
+// full-expression holding the call. Calls to routines the transpiler resolves
+// get bp::MakeArray instead
+template<typename... E>
+class SetLiteral : public Set<0, 255> {
+private:
+    static constexpr int Count = static_cast<int>(sizeof...(E));
+    static constexpr int Capacity = Count > 0 ? Count : 1;
+    static constexpr std::size_t SlotSize = 16;
+
+    std::tuple<E...> elements;
+    alignas(SlotSize) mutable unsigned char slots[Capacity * SlotSize];
+    mutable void* built = nullptr;
+    mutable void (*release)(void*) = nullptr;
+
+    template<typename T>
+    static constexpr bool InSlots = sizeof(T) <= SlotSize && alignof(T) <= SlotSize;
+
+    template<typename T>
+    static void Release(void* p) {
+        std::destroy_n(static_cast<T*>(p), Count);
+        if constexpr (!InSlots<T>)
+            std::allocator<T>().deallocate(static_cast<T*>(p), Capacity);
+    }
+
+public:
+    constexpr explicit SetLiteral(const E&... e) : elements(e...) {
+        ([&] {
+            if constexpr (internal::IsSetElement<E>)
+                Include(internal::SetOrdinal(e));
+        }(), ...);
+    }
+
+    SetLiteral(const SetLiteral&) = delete;
+    SetLiteral& operator=(const SetLiteral&) = delete;
+
+    // Elements are only built by the (run-time) OpenArray conversion, so a
+    // literal folded at compile time has nothing to release
+    constexpr ~SetLiteral() {
+        if (!std::is_constant_evaluated() && release) release(built);
+    }
+
+    template<typename T> requires (std::is_constructible_v<T, const E&> && ...)
+    operator OpenArray<const T>() const&& {
+        if (release) {
+            release(built);
+            release = nullptr;
+        }
+        T* out;
+        if constexpr (InSlots<T>)
+            out = reinterpret_cast<T*>(slots);
+        else
+            out = std::allocator<T>().allocate(Capacity);
+        int n = 0;
+        try {
+            std::apply([&](const E&... e) {
+                ((::new (static_cast<void*>(out + n)) T(e), ++n), ...);
+            }, elements);
+        } catch (...) {
+            std::destroy_n(out, n);
+            if constexpr (!InSlots<T>)
+                std::allocator<T>().deallocate(out, Capacity);
+            throw;
+        }
+        built = out;
+        release = &Release<T>;
+        return OpenArray<const T>(out, Count);
+    }
+};
+
+template<typename... E>
+inline constexpr SetLiteral<E...> MakeSet(const E&... elements) {
+    return SetLiteral<E...>(elements...);
+}
+
+template<int Low = 0, int High = 255, typename A, typename B>
+    requires (internal::IsSetElement<A> && internal::IsSetElement<B>)
+inline constexpr Set<Low, High> MakeSetRange(const A& low, const B& high) {
     Set<Low, High> s;
-    for (int i = low; i <= high; i++) s.Include(i);
+    s.IncludeRange(internal::SetOrdinal(low), internal::SetOrdinal(high));
     return s;
 }
 
+// A set literal whose elements are all literals, evaluated by the C++
+// compiler (the transpiler emits "C in ['a'..'z']" as
+// bp::InSet(BP_CONSTANT_SET((...)), C)). The set costs nothing at run time,
+// even in debug builds where MakeSet/MakeSetRange would not be inlined
+#define BP_CONSTANT_SET(...) ([]() consteval { return ::bp::Set<0, 255>(__VA_ARGS__); }())
+
 // ============================================================================
 // Free function wrappers for Pascal-style set operations
 // These match the transpiler's generated code:
 //   bp::Include(s, 1)  ->  s.Include(1)
 //   bp::Exclude(s, 3)  ->  s.Exclude(3)
 //   bp::InSet(s, 5)    ->  s.Contains(5)
+//   bp::Count(s)       ->  s.Cardinality()
 // ============================================================================
 template<int Low, int High>
-inline void Include(Set<Low, High>& s, int element) {
+inline constexpr void Include(Set<Low, High>& s, int element) {
     s.Include(element);
 }
 
 template<int Low, int High>
-inline void Exclude(Set<Low, High>& s, int element) {
+inline constexpr void Exclude(Set<Low, High>& s, int element) {
     s.Exclude(element);
 }
 
 template<int Low, int High>
-inline bool InSet(const Set<Low, High>& s, int element) {
+inline constexpr bool InSet(const Set<Low, High>& s, int element) {
     return s.Contains(element);
 }
 
+// X in [literal]: the set is a temporary, see Set::Contains() &&
+template<int Low, int High>
+inline constexpr bool InSet(Set<Low, High>&& s, int element) {
+    return std::move(s).Contains(element);
+}
+
 // Overloads for bp::Integer to reduce ambiguity in transpiled code
 template<int Low, int High>
 inline void Include(Set<Low, High>& s, const Integer& element) {
@@ -1831,4 +4083,111 @@ inline bool InSet(const Set<Low, High>& s, const Integer& element) {
     return s.Contains(element.ToInt());
 }
 
+template<int Low, int High>
+inline bool InSet(Set<Low, High>&& s, const Integer& element) {
+    return std::move(s).Contains(element.ToInt());
+}
+
+// Count(S): number of members of a set
+template<int Low, int High>
+inline constexpr int Count(const Set<Low, High>& s) {
+    return s.Cardinality();
+}
+
+// for X in S do ... : the transpiler emits a range-for over S and assigns
+// each element to X through this helper. Set members are int ordinals, so
+// when X has no assignment from the element type (an enumeration, Char) the
+// value is converted explicitly
+template<typename T, typename E>
+inline void ForInAssign(T& variable, E&& element) {
+    if constexpr (std::is_assignable_v<T&, E&&>)
+        variable = std::forward<E>(element);
+    else
+        variable = static_cast<T>(std::forward<E>(element));
+}
+
+} // namespace bp
+
+// ============================================================================
+// std::hash Specializations for bp:: Types
+// Runtime types can be used as keys of std::unordered_map/unordered_set
+// directly. Wrappers hash like the value they hold, strings use
+// String::Hash, and arrays combine the hashes of their elements.
+// std::hash<bp::String> is transparent, so a container declared with
+// std::equal_to<> can be searched with a StringView without building a String
+// ============================================================================
+
+#define BP_DEFINE_VALUE_HASH(TYPE, CONVERTER) \
+template<> \
+struct std::hash<bp::TYPE> { \
+    std::size_t operator()(const bp::TYPE& value) const noexcept { \
+        return std::hash<std::remove_cvref_t<decltype(value.CONVERTER())>>{}(value.CONVERTER()); \
+    } \
+}
+
+BP_DEFINE_VALUE_HASH(Integer, ToInt);
+BP_DEFINE_VALUE_HASH(Int64, ToInt64);
+BP_DEFINE_VALUE_HASH(UInt64, ToUInt64);
+BP_DEFINE_VALUE_HASH(Cardinal, ToCardinal);
+BP_DEFINE_VALUE_HASH(Byte, ToByte);
+BP_DEFINE_VALUE_HASH(Word, ToWord);
+BP_DEFINE_VALUE_HASH(ShortInt, ToShortInt);
+BP_DEFINE_VALUE_HASH(SmallInt, ToSmallInt);
+BP_DEFINE_VALUE_HASH(Boolean, ToBool);
+BP_DEFINE_VALUE_HASH(Pointer, ToVoidPtr);
+BP_DEFINE_VALUE_HASH(Single, ToFloat);
+BP_DEFINE_VALUE_HASH(Double, ToDouble);
+BP_DEFINE_VALUE_HASH(Extended, ToLongDouble);
+BP_DEFINE_VALUE_HASH(Char, ToChar16);
+
+#undef BP_DEFINE_VALUE_HASH
+
+template<>
+struct std::hash<bp::String> {
+    using is_transparent = void;
+    std::size_t operator()(const bp::String& value) const noexcept { return value.Hash(); }
+    std::size_t operator()(const bp::StringView& value) const noexcept { return value.Hash(); }
+};
+
+template<>
+struct std::hash<bp::StringView> {
+    using is_transparent = void;
+    std::size_t operator()(const bp::StringView& value) const noexcept { return value.Hash(); }
+    std::size_t operator()(const bp::String& value) const noexcept { return value.Hash(); }
+};
+
+template<int Low, int High>
+struct std::hash<bp::Set<Low, High>> {
+    std::size_t operator()(const bp::Set<Low, High>& value) const noexcept { return value.Hash(); }
+};
+
+namespace bp {
+namespace internal {
+
+// Order-dependent combination of element hashes (Array, StaticArray)
+template<typename It>
+inline std::size_t HashRange(It first, It last) {
+    using T = std::remove_cvref_t<decltype(*first)>;
+    std::uint64_t h = 0;
+    for (; first != last; ++first) {
+        h = simd::HashMix(h ^ 0x2d358dccaa6c78a5ull, std::hash<T>{}(*first) ^ 0x8bb84b93962eacc9ull);
+    }
+    return static_cast<std::size_t>(h);
+}
+
+} // namespace internal
 } // namespace bp
+
+template<typename T>
+struct std::hash<bp::Array<T>> {
+    std::size_t operator()(const bp::Array<T>& value) const {
+        return bp::internal::HashRange(value.begin(), value.end());
+    }
+};
+
+template<typename T, std::size_t N>
+struct std::hash<bp::StaticArray<T, N>> {
+    std::size_t operator()(const bp::StaticArray<T, N>& value) const {
+        return bp::internal::HashRange(value.begin(), value.end());
+    }
+};
@@ -49,6 +49,18 @@ type
     atGUI
   );
 
+  { TStringEncoding }
+  TStringEncoding = (
+    seUTF16,
+    seUTF8
+  );
+
+  { TNumericMode }
+  TNumericMode = (
+    nmWrapped,
+    nmThin
+  );
+
   { TOutputCallback }
   TOutputCallback = reference to procedure(const AText: string; const AUserData: Pointer);
 
@@ -63,6 +75,10 @@ type
     FEnableExceptions: Boolean;
     FStripSymbols: Boolean;
     FAppType: TAppType;
+    FStringEncoding: TStringEncoding;
+    FNumericMode: TNumericMode;
+    FOverflowChecks: Boolean;
+    FRangeChecks: Boolean;
     FModulePaths: TDictionary<string, Boolean>;
     FIncludePaths: TDictionary<string, Boolean>;
     FSourcePaths: TDictionary<string, Boolean>;
@@ -99,6 +115,14 @@ type
     function GetStripSymbols(): Boolean;
     procedure SetAppType(const AAppType: TAppType);
     function GetAppType(): TAppType;
+    procedure SetStringEncoding(const AEncoding: TStringEncoding);
+    function GetStringEncoding(): TStringEncoding;
+    procedure SetNumericMode(const AMode: TNumericMode);
+    function GetNumericMode(): TNumericMode;
+    procedure SetOverflowChecks(const AEnable: Boolean);
+    function GetOverflowChecks(): Boolean;
+    procedure SetRangeChecks(const AEnable: Boolean);
+    function GetRangeChecks(): Boolean;
 
     procedure AddModulePath(const APath: string);
     procedure AddIncludePath(const APath: string);
@@ -153,6 +177,10 @@ begin
   FEnableExceptions := True;
   FStripSymbols := False;
   FAppType := atConsole;
+  FStringEncoding := seUTF16;
+  FNumericMode := nmWrapped;
+  FOverflowChecks := False;
+  FRangeChecks := False;
 
   FModulePaths := TDictionary<string, Boolean>.Create(TIStringComparer.Ordinal);
   FIncludePaths := TDictionary<string, Boolean>.Create(TIStringComparer.Ordinal);
@@ -308,6 +336,46 @@ begin
   Result := FAppType;
 end;
 
+procedure TBuild.SetStringEncoding(const AEncoding: TStringEncoding);
+begin
+  FStringEncoding := AEncoding;
+end;
+
+function TBuild.GetStringEncoding(): TStringEncoding;
+begin
+  Result := FStringEncoding;
+end;
+
+procedure TBuild.SetNumericMode(const AMode: TNumericMode);
+begin
+  FNumericMode := AMode;
+end;
+
+function TBuild.GetNumericMode(): TNumericMode;
+begin
+  Result := FNumericMode;
+end;
+
+procedure TBuild.SetOverflowChecks(const AEnable: Boolean);
+begin
+  FOverflowChecks := AEnable;
+end;
+
+function TBuild.GetOverflowChecks(): Boolean;
+begin
+  Result := FOverflowChecks;
+end;
+
+procedure TBuild.SetRangeChecks(const AEnable: Boolean);
+begin
+  FRangeChecks := AEnable;
+end;
+
+function TBuild.GetRangeChecks(): Boolean;
+begin
+  Result := FRangeChecks;
+end;
+
 procedure TBuild.AddModulePath(const APath: string);
 begin
   if APath <> '' then
@@ -522,6 +590,10 @@ begin
   FEnableExceptions := False;
   FStripSymbols := False;
   FAppType := atConsole;
+  FStringEncoding := seUTF16;
+  FNumericMode := nmWrapped;
+  FOverflowChecks := False;
+  FRangeChecks := False;
 
   FModulePaths.Clear();
   FIncludePaths.Clear();
@@ -708,6 +780,14 @@ begin
     LBuilder.AppendLine('        "-std=c++23",');
     if not FEnableExceptions then
       LBuilder.AppendLine('        "-fno-exceptions",');
+    if FStringEncoding = seUTF8 then
+      LBuilder.AppendLine('        "-DBP_STRING_UTF8",');
+    if FNumericMode = nmThin then
+      LBuilder.AppendLine('        "-DBP_THIN_NUMERICS",');
+    if FOverflowChecks then
+      LBuilder.AppendLine('        "-DBP_OVERFLOWCHECKS",');
+    if FRangeChecks then
+      LBuilder.AppendLine('        "-DBP_RANGECHECKS",');
     LBuilder.AppendLine('    };');
     LBuilder.AppendLine('');
 
@@ -987,6 +1067,8 @@ var
   LOptimizationStr: string;
   LTargetStr: string;
   LAppTypeStr: string;
+  LStringEncodingStr: string;
+  LNumericsStr: string;
 begin
   Result := False;
 
@@ -1037,6 +1119,24 @@ begin
       SetAppType(atConsole)
     else if SameText(LAppTypeStr, 'GUI') then
       SetAppType(atGUI);
+
+    // Set string encoding
+    LStringEncodingStr := APreprocessor.GetStringEncoding();
+    if SameText(LStringEncodingStr, 'UTF8') then
+      SetStringEncoding(seUTF8)
+    else
+      SetStringEncoding(seUTF16);
+
+    // Set numeric mode
+    LNumericsStr := APreprocessor.GetNumerics();
+    if SameText(LNumericsStr, 'THIN') then
+      SetNumericMode(nmThin)
+    else
+      SetNumericMode(nmWrapped);
+
+    // Set runtime checks
+    SetOverflowChecks(SameText(APreprocessor.GetOverflowChecks(), 'ON'));
+    SetRangeChecks(SameText(APreprocessor.GetRangeChecks(), 'ON'));
   end;
 
   if not GenerateBuildZig(APreprocessor, ACodeGen, AErrors) then
@@ -34,6 +34,28 @@ implementation
 uses
   Blaise.CodeGen.Statements;
 
+// A set constructor whose elements are all literals, such as ['_', 'a'..'z']
+function IsConstantSet(const ANode: TSyntaxNode): Boolean;
+var
+  LElement: TSyntaxNode;
+  LValue: TSyntaxNode;
+begin
+  Result := Assigned(ANode) and (ANode.Typ = ntSet) and ANode.HasChildren;
+  if not Result then
+    Exit;
+  
+  for LElement in ANode.ChildNodes do
+  begin
+    if LElement.Typ <> ntElement then
+      Exit(False);
+    for LValue in LElement.ChildNodes do
+    begin
+      if LValue.Typ <> ntLiteral then
+        Exit(False);
+    end;
+  end;
+end;
+
 procedure EmitExpression(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder);
 var
   LChild: TSyntaxNode;
@@ -106,9 +128,45 @@ begin
       end;
     end;
     
+    ntSet:
+    begin
+      // Set constructor: [a, b, c..d] -> (bp::MakeSet(a, b) + bp::MakeSetRange(c, d))
+      // Each ntElement holds one expression, or two for a range. An argument
+      // for an open array parameter of a resolved routine is emitted by
+      // EmitCall as bp::MakeArray; elsewhere the literal, without ranges,
+      // also binds to an open array (bp::SetLiteral, e.g. SumInt([1, 2]))
+      var LFirst := True;
+      AOutput.Append('(bp::MakeSet(');
+      for LChild in ANode.ChildNodes do
+      begin
+        if (LChild.Typ = ntElement) and (Length(LChild.ChildNodes) = 1) then
+        begin
+          if not LFirst then
+            AOutput.Append(', ');
+          EmitExpression(ACodeGen, LChild.ChildNodes[0], AOutput);
+          LFirst := False;
+        end;
+      end;
+      AOutput.Append(')');
+      for LChild in ANode.ChildNodes do
+      begin
+        if (LChild.Typ = ntElement) and (Length(LChild.ChildNodes) >= 2) then
+        begin
+          AOutput.Append(' + bp::MakeSetRange(');
+          EmitExpression(ACodeGen, LChild.ChildNodes[0], AOutput);
+          AOutput.Append(', ');
+          EmitExpression(ACodeGen, LChild.ChildNodes[1], AOutput);
+          AOutput.Append(')');
+        end;
+      end;
+      AOutput.Append(')');
+    end;
+    
     ntIn:
     begin
       // Set membership test: value in set -> bp::InSet(set, value)
+      // A literal set is built at compile time (BP_CONSTANT_SET), so
+      // "C in ['a'..'z']" in a loop stays a bit test even in debug builds
       //LChild := nil;
       //LArrayBase := nil;
       
@@ -118,6 +176,8 @@ begin
         LArrayBase := ANode.ChildNodes[1];
         
         AOutput.Append('bp::InSet(');
+        if IsConstantSet(LArrayBase) then
+          AOutput.Append('BP_CONSTANT_SET');
         EmitExpression(ACodeGen, LArrayBase, AOutput);
         AOutput.Append(', ');
         EmitExpression(ACodeGen, LChild, AOutput);
@@ -27,9 +27,15 @@ procedure EmitMethod(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const A
 procedure EmitMethodForwardDeclaration(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 procedure EmitParameters(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIsExternal: Boolean = False);
 procedure EmitReturnType(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIsExternal: Boolean = False);
+function FindRoutineDecl(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AName: string): TSyntaxNode;
+function RoutineParameter(const ARoutine: TSyntaxNode; const AIndex: Integer): TSyntaxNode;
+function OpenArrayElementType(const ARoutine: TSyntaxNode; const AIndex: Integer): TSyntaxNode;
 
 implementation
 
+uses
+  Blaise.CodeGen.Types;
+
 procedure EmitMethod(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 var
   LName: string;
@@ -255,6 +261,20 @@ begin
     Result := ATypeName; // Use as-is for unknown types
 end;
 
+// C++ type EmitType gives for ANode, as a string
+function EmittedType(const ACodeGen: TCodeGen; const ANode: TSyntaxNode): string;
+var
+  LBuilder: TStringBuilder;
+begin
+  LBuilder := TStringBuilder.Create();
+  try
+    Blaise.CodeGen.Types.EmitType(ACodeGen, ANode, LBuilder, 0);
+    Result := LBuilder.ToString();
+  finally
+    LBuilder.Free();
+  end;
+end;
+
 procedure EmitParameters(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIsExternal: Boolean = False);
 var
   LChild: TSyntaxNode;
@@ -264,6 +284,7 @@ var
   LTypeName: string;
   LModifier: string;
   LMappedType: string;
+  LElementType: TStringBuilder;
 begin
   LFirst := True;
   
@@ -281,7 +302,31 @@ begin
       
       LModifier := LChild.GetAttribute(anKind);
       
-      if Assigned(LType) then
+      if Assigned(LType) and (not AIsExternal) and Blaise.CodeGen.Types.IsDynamicArrayType(LType) then
+      begin
+        // Open array parameter (array of T): const binds a read-only view and
+        // var a writable one, neither copies. By-value gets its own writable
+        // copy, as in Delphi
+        LElementType := TStringBuilder.Create();
+        try
+          if Assigned(LType.FindNode(ntType)) then
+            Blaise.CodeGen.Types.EmitType(ACodeGen, LType.FindNode(ntType), LElementType, 0)
+          else
+            LElementType.Append('int');
+          
+          if SameText(LModifier, 'var') or SameText(LModifier, 'out') then
+            AOutput.Append('bp::OpenArray<' + LElementType.ToString() + '> ')
+          else if SameText(LModifier, 'const') then
+            AOutput.Append('const bp::OpenArray<const ' + LElementType.ToString() + '> ')
+          else
+            AOutput.Append('bp::OpenArrayCopy<' + LElementType.ToString() + '> ');
+        finally
+          LElementType.Free();
+        end;
+        
+        AOutput.Append(ACodeGen.ResolveIdentifierName(LName));
+      end
+      else if Assigned(LType) then
       begin
         LTypeName := ACodeGen.GetNodeName(LType);
         if LTypeName = '' then
@@ -290,6 +335,8 @@ begin
         // Use raw C++ types for external functions, bp:: types for internal
         if AIsExternal then
           LMappedType := MapTypeForExternal(ACodeGen, LTypeName)
+        else if Blaise.CodeGen.Types.IsMatrixType(LType) then
+          LMappedType := EmittedType(ACodeGen, LType)
         else
           LMappedType := ACodeGen.MapType(LTypeName);
         
@@ -341,6 +388,8 @@ begin
     // Use raw C++ types for external functions, bp:: types for internal
     if AIsExternal then
       AOutput.Append(MapTypeForExternal(ACodeGen, LTypeName))
+    else if Blaise.CodeGen.Types.IsMatrixType(LTypeNode) then
+      AOutput.Append(EmittedType(ACodeGen, LTypeNode))
     else
       AOutput.Append(ACodeGen.MapType(LTypeName));
   end
@@ -348,4 +397,132 @@ begin
     AOutput.Append('void');
 end;
 
+// Routine named AName visible from ANode: the routines nested in the enclosing
+// routines, innermost first, then those of the implementation and interface
+// sections (or the program), then the interface of each used unit, the last
+// one listed first. Same lookup order as FindTypeDecl
+function FindRoutineDecl(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AName: string): TSyntaxNode;
+
+  function SearchRoutines(const AScope: TSyntaxNode): TSyntaxNode;
+  var
+    LName: string;
+  begin
+    if Assigned(AScope) then
+      for var LDecl in AScope.ChildNodes do
+        if LDecl.Typ = ntMethod then
+        begin
+          LName := ACodeGen.GetNodeName(LDecl);
+          if LName = '' then
+            LName := LDecl.GetAttribute(anName);
+          if SameText(LName, AName) then
+            Exit(LDecl);
+        end;
+    Result := nil;
+  end;
+
+  function SearchUsedUnits(const AScope: TSyntaxNode): TSyntaxNode;
+  var
+    LUsesNode: TSyntaxNode;
+    LUnitName: string;
+    LUnitNode: TSyntaxNode;
+  begin
+    Result := nil;
+    if not Assigned(AScope) then
+      Exit;
+    LUsesNode := AScope.FindNode(ntUses);
+    if not Assigned(LUsesNode) then
+      Exit;
+    for var I := High(LUsesNode.ChildNodes) downto 0 do
+    begin
+      if LUsesNode.ChildNodes[I].Typ <> ntUnit then
+        Continue;
+      LUnitName := ACodeGen.GetNodeName(LUsesNode.ChildNodes[I]);
+      if LUnitName = '' then
+        LUnitName := LUsesNode.ChildNodes[I].GetAttribute(anName);
+      LUnitNode := ACodeGen.FindUnit(LUnitName);
+      if Assigned(LUnitNode) then
+        Result := SearchRoutines(LUnitNode.FindNode(ntInterface));
+      if Assigned(Result) then
+        Exit;
+    end;
+  end;
+
+var
+  LScope: TSyntaxNode;
+  LRoot: TSyntaxNode;
+  LInImplementation: Boolean;
+begin
+  LScope := ANode;
+  LRoot := ANode;
+  LInImplementation := False;
+  while Assigned(LScope) do
+  begin
+    if LScope.Typ = ntImplementation then
+      LInImplementation := True;
+    if LScope.Typ in [ntMethod, ntImplementation, ntInterface] then
+    begin
+      Result := SearchRoutines(LScope);
+      if Assigned(Result) then
+        Exit;
+    end;
+    LRoot := LScope;
+    LScope := LScope.ParentNode;
+  end;
+  
+  Result := SearchRoutines(LRoot);
+  if not Assigned(Result) then
+    Result := SearchRoutines(LRoot.FindNode(ntInterface));
+  if Assigned(Result) then
+    Exit;
+  
+  if LInImplementation then
+    Result := SearchUsedUnits(LRoot.FindNode(ntImplementation));
+  if not Assigned(Result) then
+    Result := SearchUsedUnits(LRoot.FindNode(ntInterface));
+  if not Assigned(Result) then
+    Result := SearchUsedUnits(LRoot);
+end;
+
+// Parameter AIndex of ARoutine, or nil. Overloaded and external routines give
+// nil: the argument cannot be matched to one parameter list, or the routine
+// does not take bp:: types
+function RoutineParameter(const ARoutine: TSyntaxNode; const AIndex: Integer): TSyntaxNode;
+var
+  LParams: TSyntaxNode;
+  LIndex: Integer;
+begin
+  Result := nil;
+  if not Assigned(ARoutine) or (ARoutine.GetAttribute(anOverload) <> '') or
+     Assigned(ARoutine.FindNode(ntExternal)) then
+    Exit;
+  LParams := ARoutine.FindNode(ntParameters);
+  if not Assigned(LParams) then
+    Exit;
+  LIndex := 0;
+  for var LChild in LParams.ChildNodes do
+  begin
+    if LChild.Typ <> ntParameter then
+      Continue;
+    if LIndex = AIndex then
+      Exit(LChild);
+    Inc(LIndex);
+  end;
+end;
+
+// Element type node of parameter AIndex of ARoutine when it is an open array
+// (array of T), nil otherwise
+function OpenArrayElementType(const ARoutine: TSyntaxNode; const AIndex: Integer): TSyntaxNode;
+var
+  LParam: TSyntaxNode;
+  LType: TSyntaxNode;
+begin
+  Result := nil;
+  LParam := RoutineParameter(ARoutine, AIndex);
+  if not Assigned(LParam) then
+    Exit;
+  LType := LParam.FindNode(ntType);
+  if Assigned(LType) and Blaise.CodeGen.Types.IsDynamicArrayType(LType) then
+    Result := LType.FindNode(ntType);
+end;
+
 end.
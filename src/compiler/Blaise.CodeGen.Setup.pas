@@ -61,7 +61,32 @@ begin
   ADictionary.TryAdd('StringReplace', True);
   ADictionary.TryAdd('CompareStr', True);
   ADictionary.TryAdd('SameText', True);
+  ADictionary.TryAdd('AnsiUpperCase', True);
+  ADictionary.TryAdd('AnsiLowerCase', True);
+  ADictionary.TryAdd('AnsiSameText', True);
   ADictionary.TryAdd('QuotedStr', True);
+  ADictionary.TryAdd('rfReplaceAll', True);
+  ADictionary.TryAdd('rfIgnoreCase', True);
+  
+  // StrUtils functions (runtime_strutils.h)
+  ADictionary.TryAdd('ReverseString', True);
+  ADictionary.TryAdd('LeftStr', True);
+  ADictionary.TryAdd('RightStr', True);
+  ADictionary.TryAdd('MidStr', True);
+  ADictionary.TryAdd('LeftBStr', True);
+  ADictionary.TryAdd('RightBStr', True);
+  ADictionary.TryAdd('ContainsStr', True);
+  ADictionary.TryAdd('StartsStr', True);
+  ADictionary.TryAdd('EndsStr', True);
+  ADictionary.TryAdd('ContainsText', True);
+  ADictionary.TryAdd('StartsText', True);
+  ADictionary.TryAdd('EndsText', True);
+  ADictionary.TryAdd('DupeString', True);
+  ADictionary.TryAdd('StuffString', True);
+  ADictionary.TryAdd('ReplaceStr', True);
+  ADictionary.TryAdd('ReplaceText', True);
+  ADictionary.TryAdd('PadLeft', True);
+  ADictionary.TryAdd('PadRight', True);
   
   // Array/string functions
   ADictionary.TryAdd('SetLength', True);
@@ -69,10 +94,15 @@ begin
   ADictionary.TryAdd('Length', True);
   ADictionary.TryAdd('High', True);
   ADictionary.TryAdd('Low', True);
+  ADictionary.TryAdd('Concat', True);
+  
+  // Runtime classes (class methods: TArray.Sort(A) -> bp::TArray::Sort(A))
+  ADictionary.TryAdd('TArray', True);
   
   // Set functions
   ADictionary.TryAdd('Include', True);
   ADictionary.TryAdd('Exclude', True);
+  ADictionary.TryAdd('Count', True);
   
   // File I/O functions
   ADictionary.TryAdd('AssignFile', True);
@@ -169,6 +199,20 @@ begin
   ADictionary.TryAdd('Max', True);
   ADictionary.TryAdd('Sign', True);
 
+  // Array statistics (Math unit)
+  ADictionary.TryAdd('Sum', True);
+  ADictionary.TryAdd('SumInt', True);
+  ADictionary.TryAdd('SumOfSquares', True);
+  ADictionary.TryAdd('MinValue', True);
+  ADictionary.TryAdd('MaxValue', True);
+  ADictionary.TryAdd('MinIntValue', True);
+  ADictionary.TryAdd('MaxIntValue', True);
+  ADictionary.TryAdd('Mean', True);
+  ADictionary.TryAdd('Variance', True);
+  ADictionary.TryAdd('StdDev', True);
+  ADictionary.TryAdd('MeanAndStdDev', True);
+  ADictionary.TryAdd('Norm', True);
+
   // Ordinal functions
   ADictionary.TryAdd('Ord', True);
   ADictionary.TryAdd('Chr', True);
@@ -204,6 +248,7 @@ begin
   ADictionary.Add('File', 'bp::File');
   ADictionary.Add('TextFile', 'bp::TextFile');
   ADictionary.Add('Text', 'bp::TextFile');
+  ADictionary.Add('TStringBuilder', 'bp::TStringBuilder');
 end;
 
 procedure SetupOperatorMappings(const ADictionary: TDictionary<TSyntaxNodeType, string>);
@@ -37,6 +37,10 @@ procedure EmitWith(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOu
 
 implementation
 
+uses
+  Blaise.CodeGen.Methods,
+  Blaise.CodeGen.Types;
+
 procedure EmitCastedLiteral(const ACodeGen: TCodeGen; const ALiteralNode: TSyntaxNode; const AOutput: TStringBuilder);
 var
   LValue: string;
@@ -136,6 +140,39 @@ begin
   end;
 end;
 
+// String literal that is the whole of AExprNode (an RHS or an argument), or nil
+function SoleStringLiteral(const AExprNode: TSyntaxNode): TSyntaxNode;
+var
+  LNode: TSyntaxNode;
+begin
+  Result := nil;
+  LNode := AExprNode;
+  while Assigned(LNode) and (LNode.Typ in [ntRHS, ntExpression]) and (Length(LNode.ChildNodes) = 1) do
+    LNode := LNode.ChildNodes[0];
+  if Assigned(LNode) and (LNode.Typ = ntLiteral) and SameText(LNode.GetAttribute(anType), 'string') then
+    Result := LNode;
+end;
+
+// A string literal stored into a String: BP_STRING_LITERAL(L"text") gives the
+// literal its own static buffer at this call site, so repeated evaluation
+// only shares it. False (nothing emitted) when AExprNode is not a literal or
+// ATypeName is not String
+function EmitStringLiteral(const ACodeGen: TCodeGen; const AExprNode: TSyntaxNode; const ATypeName: string; const AOutput: TStringBuilder): Boolean;
+var
+  LLiteral: TSyntaxNode;
+begin
+  Result := False;
+  if (ATypeName = '') or (ACodeGen.MapType(ATypeName) <> 'bp::String') then
+    Exit;
+  LLiteral := SoleStringLiteral(AExprNode);
+  if not Assigned(LLiteral) then
+    Exit;
+  AOutput.Append('BP_STRING_LITERAL(');
+  ACodeGen.EmitExpression(LLiteral, AOutput);
+  AOutput.Append(')');
+  Result := True;
+end;
+
 function CanOptimizeToInPlaceConcat(const ACodeGen: TCodeGen; 
   const ALLHS: TSyntaxNode; const ARLHS: TSyntaxNode; 
   out ARHSRight: TSyntaxNode): Boolean;
@@ -369,17 +406,52 @@ begin
   begin
     // Pass target type context to expression emission
     ACodeGen.SetTargetType(LTargetType);
-    ACodeGen.EmitExpression(LRHS, AOutput);
+    if not EmitStringLiteral(ACodeGen, LRHS, LTargetType, AOutput) then
+      ACodeGen.EmitExpression(LRHS, AOutput);
     ACodeGen.ClearTargetType();
   end;
   
   AOutput.AppendLine(';');
 end;
 
+// Array literal argument for an open array parameter of element type
+// AElementType: [a, b] -> bp::MakeArray<T>(a, b), a stack array that lives
+// for the call. False (nothing emitted) when AExprNode is not a plain [...]
+// literal; ranges only make sense in a set
+function EmitArrayLiteral(const ACodeGen: TCodeGen; const AExprNode: TSyntaxNode; const AElementType: TSyntaxNode; const AOutput: TStringBuilder): Boolean;
+var
+  LSetNode: TSyntaxNode;
+  LFirst: Boolean;
+begin
+  Result := False;
+  if (Length(AExprNode.ChildNodes) <> 1) or (AExprNode.ChildNodes[0].Typ <> ntSet) then
+    Exit;
+  LSetNode := AExprNode.ChildNodes[0];
+  for var LChild in LSetNode.ChildNodes do
+    if (LChild.Typ = ntElement) and (Length(LChild.ChildNodes) <> 1) then
+      Exit;
+  
+  AOutput.Append('bp::MakeArray<');
+  EmitType(ACodeGen, AElementType, AOutput, 0);
+  AOutput.Append('>(');
+  LFirst := True;
+  for var LChild in LSetNode.ChildNodes do
+    if LChild.Typ = ntElement then
+    begin
+      if not LFirst then
+        AOutput.Append(', ');
+      ACodeGen.EmitExpression(LChild.ChildNodes[0], AOutput);
+      LFirst := False;
+    end;
+  AOutput.Append(')');
+  Result := True;
+end;
+
 procedure EmitCall(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 var
   LChild: TSyntaxNode;
   LIdNode: TSyntaxNode;
+  LDotNode: TSyntaxNode;
   LExprsNode: TSyntaxNode;
   LExprNode: TSyntaxNode;
   LExprChild: TSyntaxNode;
@@ -387,6 +459,12 @@ var
   LFuncName: string;
   LIsSizeOf: Boolean;
   LArgIdentifier: string;
+  LClassName: string;
+  LRoutine: TSyntaxNode;
+  LArgIndex: Integer;
+  LElementType: TSyntaxNode;
+  LParam: TSyntaxNode;
+  LParamType: string;
 begin
   if AIndent > 0 then
   begin
@@ -394,14 +472,17 @@ begin
     AOutput.Append(ACodeGen.GetIndent(AIndent));
   end;
   
-  // Find the identifier and expressions nodes
+  // Find the identifier (or Value.Method) and expressions nodes
   LIdNode := nil;
+  LDotNode := nil;
   LExprsNode := nil;
   
   for LChild in ANode.ChildNodes do
   begin
     if LChild.Typ = ntIdentifier then
       LIdNode := LChild
+    else if LChild.Typ = ntDot then
+      LDotNode := LChild
     else if LChild.Typ = ntExpressions then
       LExprsNode := LChild
     else if LChild.Typ = ntCall then
@@ -549,6 +630,7 @@ begin
     else
     begin
       // Normal function call
+      LRoutine := nil;
       // Check if this is a TYPE CAST (type constructor call) that needs bp:: prefix
       if ACodeGen.TypeMappings().ContainsKey(LFuncName) then
       begin
@@ -560,12 +642,18 @@ begin
       else if ACodeGen.RuntimeFunctions().ContainsKey(LFuncName) then
         AOutput.Append('bp::' + ACodeGen.GetRuntimeFunctionName(LFuncName))
       else
+      begin
         ACodeGen.EmitIdentifier(LIdNode, AOutput);
+        // The declaration decides whether a [...] argument is a set or an
+        // array literal for an open array parameter
+        LRoutine := FindRoutineDecl(ACodeGen, ANode, LFuncName);
+      end;
       AOutput.Append('(');
       
       if Assigned(LExprsNode) then
       begin
         LFirst := True;
+        LArgIndex := 0;
         for LExprNode in LExprsNode.ChildNodes do
         begin
           if LExprNode.Typ = ntExpression then
@@ -573,6 +661,16 @@ begin
             if not LFirst then
               AOutput.Append(', ');
             LFirst := False;
+            LElementType := OpenArrayElementType(LRoutine, LArgIndex);
+            LParam := RoutineParameter(LRoutine, LArgIndex);
+            LParamType := '';
+            if Assigned(LParam) and Assigned(LParam.FindNode(ntType)) then
+            begin
+              LParamType := ACodeGen.GetNodeName(LParam.FindNode(ntType));
+              if LParamType = '' then
+                LParamType := LParam.FindNode(ntType).GetAttribute(anName);
+            end;
+            Inc(LArgIndex);
             
             // Check if this is a floating-point literal (or unary minus of one)
             // that needs casting for overloaded runtime functions
@@ -582,9 +680,12 @@ begin
               // Cast it based on target type context
               EmitExpressionWithCast(ACodeGen, LExprNode, AOutput);
             end
-            else
+            else if not (Assigned(LElementType) and EmitArrayLiteral(ACodeGen, LExprNode, LElementType, AOutput)) and
+                    not EmitStringLiteral(ACodeGen, LExprNode, LParamType, AOutput) then
             begin
-              // Walk the expression's children normally
+              // Walk the expression's children normally (a [a, b] passed to
+              // an open array parameter, or a literal passed to a string
+              // parameter, was emitted above)
               for LExprChild in LExprNode.ChildNodes do
                 ACodeGen.EmitExpression(LExprChild, AOutput);
             end;
@@ -594,6 +695,54 @@ begin
       
       AOutput.Append(')');
     end;
+  end
+  else if Assigned(LDotNode) and (Length(LDotNode.ChildNodes) >= 2) then
+  begin
+    // Method call on a runtime value type, e.g. SB.Append(X) -> SB.Append(X)
+    // The member name is emitted as written (it is never a bp:: function)
+    // Class methods of runtime classes are static members:
+    // TArray.Sort<Integer>(A) -> bp::TArray::Sort(A) (the runtime deduces T)
+    LClassName := '';
+    if LDotNode.ChildNodes[0].Typ = ntIdentifier then
+    begin
+      LClassName := ACodeGen.GetNodeValue(LDotNode.ChildNodes[0]);
+      if LClassName = '' then
+        LClassName := LDotNode.ChildNodes[0].GetAttribute(anName);
+    end;
+    
+    LChild := LDotNode.ChildNodes[1];
+    if (LChild.Typ = ntGeneric) and Assigned(LChild.FindNode(ntIdentifier)) then
+      LChild := LChild.FindNode(ntIdentifier);
+    LFuncName := ACodeGen.GetNodeValue(LChild);
+    if LFuncName = '' then
+      LFuncName := LChild.GetAttribute(anName);
+    
+    if (LClassName <> '') and ACodeGen.RuntimeFunctions().ContainsKey(LClassName) and
+       (ACodeGen.GetRuntimeFunctionName(LClassName) = LClassName) then
+      AOutput.Append('bp::' + LClassName + '::' + LFuncName + '(')
+    else
+    begin
+      ACodeGen.EmitExpression(LDotNode.ChildNodes[0], AOutput);
+      AOutput.Append('.' + LFuncName + '(');
+    end;
+    
+    if Assigned(LExprsNode) then
+    begin
+      LFirst := True;
+      for LExprNode in LExprsNode.ChildNodes do
+      begin
+        if LExprNode.Typ = ntExpression then
+        begin
+          if not LFirst then
+            AOutput.Append(', ');
+          LFirst := False;
+          for LExprChild in LExprNode.ChildNodes do
+            ACodeGen.EmitExpression(LExprChild, AOutput);
+        end;
+      end;
+    end;
+    
+    AOutput.Append(')');
   end;
   
   if AIndent > 0 then
@@ -675,12 +824,53 @@ begin
   AOutput.AppendLine('}');
 end;
 
+procedure EmitForIn(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AVariable: TSyntaxNode; const AIn: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
+var
+  LVarName: string;
+  LItemName: string;
+begin
+  LVarName := ACodeGen.GetNodeValue(AVariable);
+  if LVarName = '' then
+    LVarName := AVariable.GetAttribute(anName);
+  
+  // Apply identifier conflict resolution
+  LVarName := ACodeGen.ResolveIdentifierName(LVarName);
+  LItemName := 'bp_item_' + LVarName;
+  
+  // for X in S do ...  ->  for (auto&& bp_item_X : S) { bp::ForInAssign(X, bp_item_X); ... }
+  ACodeGen.EmitLineDirective(ANode, AOutput);
+  AOutput.Append(ACodeGen.GetIndent(AIndent));
+  AOutput.Append('for (auto&& ' + LItemName + ' : ');
+  
+  // Emit IN expression
+  if AIn.HasChildren then
+  begin
+    for var LChild in AIn.ChildNodes do
+      ACodeGen.EmitExpression(LChild, AOutput);
+  end;
+  
+  AOutput.AppendLine(') {');
+  AOutput.Append(ACodeGen.GetIndent(AIndent + 1));
+  AOutput.AppendLine('bp::ForInAssign(' + LVarName + ', ' + LItemName + ');');
+  
+  // Emit FOR loop body
+  for var LChild in ANode.ChildNodes do
+  begin
+    if (LChild.Typ <> ntIdentifier) and (LChild.Typ <> ntIn) then
+      ACodeGen.WalkNode(LChild, AOutput, AIndent + 1);
+  end;
+  
+  AOutput.Append(ACodeGen.GetIndent(AIndent));
+  AOutput.AppendLine('}');
+end;
+
 procedure EmitFor(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 var
   LVariable: TSyntaxNode;
   LFrom: TSyntaxNode;
   LTo: TSyntaxNode;
   LDownto: TSyntaxNode;
+  LIn: TSyntaxNode;
   LVarName: string;
   LIsDownto: Boolean;
 begin
@@ -689,6 +879,15 @@ begin
   LFrom := ANode.FindNode(ntFrom);
   LTo := ANode.FindNode(ntTo);
   LDownto := ANode.FindNode(ntDownto);
+  LIn := ANode.FindNode(ntIn);
+  
+  // FOR..IN loop: range-for over the container (sets enumerate their
+  // members with bp::Set's bit-scan iterator)
+  if Assigned(LVariable) and Assigned(LIn) then
+  begin
+    EmitForIn(ACodeGen, ANode, LVariable, LIn, AOutput, AIndent);
+    Exit;
+  end;
   
   // Determine if this is a downto loop
   LIsDownto := Assigned(LDownto);
@@ -26,6 +26,8 @@ uses
 procedure EmitTypeSection(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 procedure EmitTypeDecl(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 procedure EmitType(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
+function IsDynamicArrayType(const ANode: TSyntaxNode): Boolean;
+function IsMatrixType(const ANode: TSyntaxNode): Boolean;
 
 implementation
 
@@ -349,6 +351,247 @@ begin
   end;
 end;
 
+function IsDynamicArrayType(const ANode: TSyntaxNode): Boolean;
+var
+  LBoundsNode: TSyntaxNode;
+begin
+  // Dynamic arrays are TYPE nodes with anType="array" and no bounds
+  Result := False;
+  if not Assigned(ANode) or not SameText(ANode.GetAttribute(anType), 'array') then
+    Exit;
+  LBoundsNode := ANode.FindNode(ntBounds);
+  Result := not (Assigned(LBoundsNode) and LBoundsNode.HasChildren);
+end;
+
+// TMatrix<T>: a rectangular 2-D dynamic array in one dense buffer
+// (bp::Matrix<T>). array of array of T always stays jagged, as in Delphi, so
+// the dense layout is asked for by name rather than guessed from the uses
+function IsMatrixType(const ANode: TSyntaxNode): Boolean;
+var
+  LArgsNode: TSyntaxNode;
+begin
+  Result := False;
+  if not Assigned(ANode) or (ANode.Typ <> ntType) or not SameText(ANode.GetAttribute(anName), 'TMatrix') then
+    Exit;
+  LArgsNode := ANode.FindNode(ntTypeArgs);
+  Result := Assigned(LArgsNode) and (Length(LArgsNode.ChildNodes) = 1) and
+    (LArgsNode.ChildNodes[0].Typ = ntType);
+end;
+
+// Ordinal value of a literal: a number, or a one-character string
+function OrdinalLiteral(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; out AValue: Integer): Boolean;
+var
+  LNode: TSyntaxNode;
+  LText: string;
+begin
+  Result := False;
+  LNode := ANode;
+  while Assigned(LNode) and (LNode.Typ <> ntLiteral) and (Length(LNode.ChildNodes) = 1) do
+    LNode := LNode.ChildNodes[0];
+  if not Assigned(LNode) or (LNode.Typ <> ntLiteral) then
+    Exit;
+  
+  LText := ACodeGen.GetNodeValue(LNode);
+  if SameText(LNode.GetAttribute(anType), 'string') then
+  begin
+    Result := Length(LText) = 1;
+    if Result then
+      AValue := Ord(LText[1]);
+  end
+  else
+    Result := TryStrToInt(LText, AValue);
+end;
+
+// Bounds of a subrange: the first two children are literal expressions
+function LiteralBounds(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; out ALow, AHigh: Integer): Boolean;
+begin
+  Result := (Length(ANode.ChildNodes) >= 2) and
+    OrdinalLiteral(ACodeGen, ANode.ChildNodes[0], ALow) and
+    OrdinalLiteral(ACodeGen, ANode.ChildNodes[1], AHigh);
+end;
+
+// Highest ordinal of an enumeration. Elements count up from 0, or from an
+// explicit literal value
+function EnumHighValue(const ACodeGen: TCodeGen; const AEnumNode: TSyntaxNode; out AHigh: Integer): Boolean;
+var
+  LChild: TSyntaxNode;
+  LValueNode: TSyntaxNode;
+  LValue: Integer;
+begin
+  Result := False;
+  AHigh := -1;
+  LValue := -1;
+  for LChild in AEnumNode.ChildNodes do
+  begin
+    if LChild.Typ = ntElement then
+    begin
+      LValueNode := LChild.FindNode(ntValue);
+      if not Assigned(LValueNode) then
+        Inc(LValue)
+      else if not OrdinalLiteral(ACodeGen, LValueNode, LValue) then
+        Exit;
+    end
+    else if LChild.Typ = ntIdentifier then
+      Inc(LValue)
+    else if LChild.Typ = ntExpression then
+    begin
+      // Explicit value of the preceding identifier
+      if not OrdinalLiteral(ACodeGen, LChild, LValue) then
+        Exit;
+    end
+    else
+      Continue;
+    
+    if LValue > AHigh then
+      AHigh := LValue;
+  end;
+  Result := AHigh >= 0;
+end;
+
+// Type declaration named AName visible from ANode: the type sections of the
+// enclosing routines, innermost first, then those of the implementation and
+// interface sections (or the program), then the interface of each used unit,
+// the last one listed first (as Pascal resolves names)
+function FindTypeDecl(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AName: string): TSyntaxNode;
+
+  function SearchSections(const AScope: TSyntaxNode): TSyntaxNode;
+  var
+    LName: string;
+  begin
+    if Assigned(AScope) then
+      for var LSection in AScope.ChildNodes do
+        if LSection.Typ = ntTypeSection then
+          for var LDecl in LSection.ChildNodes do
+            if LDecl.Typ = ntTypeDecl then
+            begin
+              LName := ACodeGen.GetNodeName(LDecl);
+              if LName = '' then
+                LName := LDecl.GetAttribute(anName);
+              if SameText(LName, AName) then
+                Exit(LDecl);
+            end;
+    Result := nil;
+  end;
+
+  function SearchUsedUnits(const AScope: TSyntaxNode): TSyntaxNode;
+  var
+    LUsesNode: TSyntaxNode;
+    LUnitName: string;
+    LUnitNode: TSyntaxNode;
+  begin
+    Result := nil;
+    if not Assigned(AScope) then
+      Exit;
+    LUsesNode := AScope.FindNode(ntUses);
+    if not Assigned(LUsesNode) then
+      Exit;
+    for var I := High(LUsesNode.ChildNodes) downto 0 do
+    begin
+      if LUsesNode.ChildNodes[I].Typ <> ntUnit then
+        Continue;
+      LUnitName := ACodeGen.GetNodeName(LUsesNode.ChildNodes[I]);
+      if LUnitName = '' then
+        LUnitName := LUsesNode.ChildNodes[I].GetAttribute(anName);
+      LUnitNode := ACodeGen.FindUnit(LUnitName);
+      if Assigned(LUnitNode) then
+        Result := SearchSections(LUnitNode.FindNode(ntInterface));
+      if Assigned(Result) then
+        Exit;
+    end;
+  end;
+
+var
+  LScope: TSyntaxNode;
+  LRoot: TSyntaxNode;
+  LInImplementation: Boolean;
+begin
+  // Enclosing routines and sections, up to the unit or program
+  LScope := ANode;
+  LRoot := ANode;
+  LInImplementation := False;
+  while Assigned(LScope) do
+  begin
+    if LScope.Typ = ntImplementation then
+      LInImplementation := True;
+    if LScope.Typ in [ntMethod, ntImplementation, ntInterface] then
+    begin
+      Result := SearchSections(LScope);
+      if Assigned(Result) then
+        Exit;
+    end;
+    LRoot := LScope;
+    LScope := LScope.ParentNode;
+  end;
+  
+  // Program declarations, or the unit interface seen from the implementation
+  Result := SearchSections(LRoot);
+  if not Assigned(Result) then
+    Result := SearchSections(LRoot.FindNode(ntInterface));
+  if Assigned(Result) then
+    Exit;
+  
+  if LInImplementation then
+    Result := SearchUsedUnits(LRoot.FindNode(ntImplementation));
+  if not Assigned(Result) then
+    Result := SearchUsedUnits(LRoot.FindNode(ntInterface));
+  if not Assigned(Result) then
+    Result := SearchUsedUnits(LRoot);
+end;
+
+// Range of a set type: "set of 0..9", "set of 'a'..'z'", "set of (A, B)",
+// "set of Boolean", or a named enumeration or subrange in scope where the
+// set is declared. False when the range is not known here
+function SetTypeBounds(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; out ALow, AHigh: Integer): Boolean;
+var
+  LBase: TSyntaxNode;
+  LName: string;
+  LDecl: TSyntaxNode;
+  LDepth: Integer;
+begin
+  Result := False;
+  ALow := 0;
+  AHigh := 255;
+  
+  LBase := ANode.FindNode(ntType);
+  if not Assigned(LBase) then
+    Result := LiteralBounds(ACodeGen, ANode, ALow, AHigh)
+  else
+  begin
+    // Follow type names to their declarations (TDigit = 0..9; TDigits = set of TDigit)
+    for LDepth := 1 to 8 do
+    begin
+      LName := LBase.GetAttribute(anName);
+      if SameText(LName, 'enum') or SameText(LBase.GetAttribute(anKind), 'enum') then
+      begin
+        ALow := 0;
+        Result := EnumHighValue(ACodeGen, LBase, AHigh);
+        Break;
+      end;
+      if SameText(LName, 'subrange') then
+      begin
+        Result := LiteralBounds(ACodeGen, LBase, ALow, AHigh);
+        Break;
+      end;
+      if SameText(LName, 'Boolean') then
+      begin
+        ALow := 0;
+        AHigh := 1;
+        Result := True;
+        Break;
+      end;
+      
+      LDecl := FindTypeDecl(ACodeGen, ANode, LName);
+      if Assigned(LDecl) then
+        LBase := LDecl.FindNode(ntType);
+      if not Assigned(LDecl) or not Assigned(LBase) then
+        Break;
+    end;
+  end;
+  
+  // Pascal sets hold ordinals 0..255
+  Result := Result and (ALow >= 0) and (ALow <= AHigh) and (AHigh <= 255);
+end;
+
 procedure EmitType(const ACodeGen: TCodeGen; const ANode: TSyntaxNode; const AOutput: TStringBuilder; const AIndent: Integer);
 var
   LTypeName: string;
@@ -457,33 +700,12 @@ begin
   end
   else if SameText(LTypeAttr, 'set') then
   begin
-    // Set type - extract low and high bounds
-    // LLowExpr := nil;
-    // LHighExpr := nil;
-    // LLowVal := 0;
-    //LHighVal := 0;
-    
-    // Get bounds from child EXPRESSION nodes
-    if ANode.HasChildren and (Length(ANode.ChildNodes) >= 2) then
-    begin
-      LLowExpr := ANode.ChildNodes[0];
-      LHighExpr := ANode.ChildNodes[1];
-      
-      // Extract literal values
-      if LLowExpr.HasChildren and (LLowExpr.ChildNodes[0].Typ = ntLiteral) then
-        LLowVal := StrToIntDef(ACodeGen.GetNodeValue(LLowExpr.ChildNodes[0]), 0)
-      else
-        LLowVal := 0;
-      
-      if LHighExpr.HasChildren and (LHighExpr.ChildNodes[0].Typ = ntLiteral) then
-        LHighVal := StrToIntDef(ACodeGen.GetNodeValue(LHighExpr.ChildNodes[0]), 0)
-      else
-        LHighVal := 0;
-      
-      AOutput.Append('bp::Set<' + IntToStr(LLowVal) + ', ' + IntToStr(LHighVal) + '>');
-    end
+    // Set type: bp::Set<Low, High> sizes its storage from the range, so
+    // resolve literal subranges and enumerations; anything else covers 0..255
+    if SetTypeBounds(ACodeGen, ANode, LLowVal, LHighVal) then
+      AOutput.Append('bp::Set<' + IntToStr(LLowVal) + ', ' + IntToStr(LHighVal) + '>')
     else
-      AOutput.Append('bp::Set<0, 255>'); // fallback for unbounded sets
+      AOutput.Append('bp::Set<0, 255>');
   end
   else if SameText(LTypeAttr, 'pointer') then
   begin
@@ -578,7 +800,14 @@ begin
     begin
       // Dynamic array - no bounds
       LElementTypeNode := ANode.FindNode(ntType);
-      if Assigned(LElementTypeNode) then
+      if IsDynamicArrayType(LElementTypeNode) then
+      begin
+        // array of array of T -> bp::Array<bp::Array<T>> (rows sized one by one)
+        AOutput.Append('bp::Array<');
+        EmitType(ACodeGen, LElementTypeNode, AOutput, AIndent);
+        AOutput.Append('>');
+      end
+      else if Assigned(LElementTypeNode) then
       begin
         LElementTypeName := ACodeGen.GetNodeName(LElementTypeNode);
         if LElementTypeName = '' then
@@ -589,6 +818,13 @@ begin
         AOutput.Append('bp::Array<int>');
     end;
   end
+  else if IsMatrixType(ANode) then
+  begin
+    // TMatrix<T> -> bp::Matrix<T> (one row-major buffer)
+    AOutput.Append('bp::Matrix<');
+    EmitType(ACodeGen, ANode.FindNode(ntTypeArgs).ChildNodes[0], AOutput, AIndent);
+    AOutput.Append('>');
+  end
   else
   begin
     LTypeName := ACodeGen.GetNodeName(ANode);
@@ -48,6 +48,8 @@ var
   LIsArray: Boolean;
   LIsSet: Boolean;
   LIsStaticArray: Boolean;
+  LIsNestedArray: Boolean;
+  LIsMatrix: Boolean;
   LPointeeType: TSyntaxNode;
   LElementType: TSyntaxNode;
   LElementTypeName: string;
@@ -71,12 +73,19 @@ begin
   
   // Check if array has bounds (static array)
   LIsStaticArray := False;
+  LIsNestedArray := False;
+  LIsMatrix := False;
   if LIsArray then
   begin
     LBoundsNode := LTypeNode.FindNode(ntBounds);
     LIsStaticArray := Assigned(LBoundsNode) and LBoundsNode.HasChildren;
+    // array of array of T: nested bp::Array, emitted via EmitType
+    LIsNestedArray := not LIsStaticArray and Blaise.CodeGen.Types.IsDynamicArrayType(LTypeNode.FindNode(ntType));
   end;
   
+  // TMatrix<T>: bp::Matrix<T>, emitted via EmitType
+  LIsMatrix := Blaise.CodeGen.Types.IsMatrixType(LTypeNode);
+  
   if LIsPointer then
   begin
     // Get the pointee type (child TYPE node)
@@ -90,9 +99,9 @@ begin
     else
       LTypeName := 'void';
   end
-  else if LIsStaticArray then
+  else if LIsStaticArray or LIsNestedArray or LIsMatrix then
   begin
-    // Static array - will be emitted via EmitType
+    // Static, nested array or matrix - will be emitted via EmitType
     LTypeName := ''; // Will be handled specially below
   end
   else if LIsArray then
@@ -130,8 +139,8 @@ begin
   if ACodeGen.InInterfaceSection() then
     AOutput.Append('extern ');
   
-  // For sets and static arrays, emit the type directly using EmitType
-  if LIsSet or LIsStaticArray then
+  // For sets, static and nested arrays and matrices, emit the type directly using EmitType
+  if LIsSet or LIsStaticArray or LIsNestedArray or LIsMatrix then
   begin
     Blaise.CodeGen.Types.EmitType(ACodeGen, LTypeNode, AOutput, AIndent);
   end
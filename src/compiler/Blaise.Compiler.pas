@@ -66,6 +66,10 @@ type
     procedure SetEnableExceptions(const AEnable: Boolean);
     procedure SetStripSymbols(const AStrip: Boolean);
     procedure SetAppType(const AAppType: TAppType);
+    procedure SetStringEncoding(const AEncoding: TStringEncoding);
+    procedure SetNumericMode(const AMode: TNumericMode);
+    procedure SetOverflowChecks(const AEnable: Boolean);
+    procedure SetRangeChecks(const AEnable: Boolean);
 
     procedure AddModulePath(const APath: string);
     procedure AddIncludePath(const APath: string);
@@ -445,6 +449,26 @@ begin
   FBuild.SetAppType(AAppType);
 end;
 
+procedure TCompiler.SetStringEncoding(const AEncoding: TStringEncoding);
+begin
+  FBuild.SetStringEncoding(AEncoding);
+end;
+
+procedure TCompiler.SetNumericMode(const AMode: TNumericMode);
+begin
+  FBuild.SetNumericMode(AMode);
+end;
+
+procedure TCompiler.SetOverflowChecks(const AEnable: Boolean);
+begin
+  FBuild.SetOverflowChecks(AEnable);
+end;
+
+procedure TCompiler.SetRangeChecks(const AEnable: Boolean);
+begin
+  FBuild.SetRangeChecks(AEnable);
+end;
+
 procedure TCompiler.AddModulePath(const APath: string);
 begin
   FBuild.AddModulePath(APath);
@@ -36,6 +36,10 @@ type
     FOptimization: string;
     FTarget: string;
     FAppType: string;
+    FStringEncoding: string;
+    FNumerics: string;
+    FOverflowChecks: string;
+    FRangeChecks: string;
     FIsMainFile: Boolean;
     FSupportedDirectives: TDictionary<string, Boolean>;
 
@@ -61,6 +65,10 @@ type
     function GetOptimization(): string;
     function GetTarget(): string;
     function GetAppType(): string;
+    function GetStringEncoding(): string;
+    function GetNumerics(): string;
+    function GetOverflowChecks(): string;
+    function GetRangeChecks(): string;
 
     property SourceFile: string read FSourceFile;
   end;
@@ -88,6 +96,10 @@ begin
   FOptimization := 'Debug';
   FTarget := 'native';
   FAppType := 'CONSOLE';
+  FStringEncoding := 'UTF16';
+  FNumerics := 'WRAPPED';
+  FOverflowChecks := 'OFF';
+  FRangeChecks := 'OFF';
 
   FSupportedDirectives := TDictionary<string, Boolean>.Create(TIStringComparer.Ordinal());
 
@@ -118,6 +130,10 @@ begin
   FOptimization := 'Debug';
   FTarget := 'native';
   FAppType := 'CONSOLE';
+  FStringEncoding := 'UTF16';
+  FNumerics := 'WRAPPED';
+  FOverflowChecks := 'OFF';
+  FRangeChecks := 'OFF';
 end;
 
 procedure TPreprocessor.InitializeSupportedDirectives();
@@ -135,6 +151,10 @@ begin
   FSupportedDirectives.TryAdd('OPTIMIZATION', True);
   FSupportedDirectives.TryAdd('TARGET', True);
   FSupportedDirectives.TryAdd('APPTYPE', True);
+  FSupportedDirectives.TryAdd('STRING_ENCODING', True);
+  FSupportedDirectives.TryAdd('NUMERICS', True);
+  FSupportedDirectives.TryAdd('OVERFLOWCHECKS', True);
+  FSupportedDirectives.TryAdd('RANGECHECKS', True);
 
   // Future directives can be added here:
   // FSupportedDirectives.TryAdd('DEFINE', True);
@@ -306,6 +326,58 @@ begin
       else
         FAppType := 'CONSOLE'; // Default for invalid values
     end;
+  end
+  else if SameText(LDirectiveName, 'STRING_ENCODING') then
+  begin
+    // Only process build directives from main file
+    if FIsMainFile then
+    begin
+      LDequotedValue := DequoteValue(LValue);
+      // Validate: UTF16 or UTF8 (the storage of String in the C++ runtime)
+      if SameText(LDequotedValue, 'UTF16') or SameText(LDequotedValue, 'UTF8') then
+        FStringEncoding := UpperCase(LDequotedValue)
+      else
+        FStringEncoding := 'UTF16'; // Default for invalid values
+    end;
+  end
+  else if SameText(LDirectiveName, 'NUMERICS') then
+  begin
+    // Only process build directives from main file
+    if FIsMainFile then
+    begin
+      LDequotedValue := DequoteValue(LValue);
+      // Validate: WRAPPED or THIN (whether numeric wrappers are force-inlined)
+      if SameText(LDequotedValue, 'WRAPPED') or SameText(LDequotedValue, 'THIN') then
+        FNumerics := UpperCase(LDequotedValue)
+      else
+        FNumerics := 'WRAPPED'; // Default for invalid values
+    end;
+  end
+  else if SameText(LDirectiveName, 'OVERFLOWCHECKS') then
+  begin
+    // Only process build directives from main file
+    if FIsMainFile then
+    begin
+      LDequotedValue := DequoteValue(LValue);
+      // Validate: ON or OFF (checked Integer/Int64 arithmetic in the C++ runtime)
+      if SameText(LDequotedValue, 'ON') or SameText(LDequotedValue, 'OFF') then
+        FOverflowChecks := UpperCase(LDequotedValue)
+      else
+        FOverflowChecks := 'OFF'; // Default for invalid values
+    end;
+  end
+  else if SameText(LDirectiveName, 'RANGECHECKS') then
+  begin
+    // Only process build directives from main file
+    if FIsMainFile then
+    begin
+      LDequotedValue := DequoteValue(LValue);
+      // Validate: ON or OFF (checked Array/String indexing in the C++ runtime)
+      if SameText(LDequotedValue, 'ON') or SameText(LDequotedValue, 'OFF') then
+        FRangeChecks := UpperCase(LDequotedValue)
+      else
+        FRangeChecks := 'OFF'; // Default for invalid values
+    end;
   end;
 end;
 
@@ -378,4 +450,24 @@ begin
   Result := FAppType;
 end;
 
+function TPreprocessor.GetStringEncoding(): string;
+begin
+  Result := FStringEncoding;
+end;
+
+function TPreprocessor.GetNumerics(): string;
+begin
+  Result := FNumerics;
+end;
+
+function TPreprocessor.GetOverflowChecks(): string;
+begin
+  Result := FOverflowChecks;
+end;
+
+function TPreprocessor.GetRangeChecks(): string;
+begin
+  Result := FRangeChecks;
+end;
+
 end.
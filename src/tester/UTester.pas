@@ -83,6 +83,7 @@ begin
     LTester.AddTest(32, 'ProgramStringAdvanced.pas', 0, True, True, False);
     LTester.AddTest(33, 'ProgramStringsAndWith.pas', 0, True, True, False);
     LTester.AddTest(34, 'ProgramWideString.pas', 0, True, True, False);
+    LTester.AddTest(36, 'ProgramStringUTF8.pas', 0, True, True, False);
     
     // ========================================
     // RECORDS - Record types
@@ -142,12 +143,15 @@ begin
     // ========================================
     LTester.AddTest(75, 'ProgramTypeAliases.pas', 0, True, True, False);
     LTester.AddTest(76, 'ProgramTypedConstants.pas', 0, True, True, False);
+    LTester.AddTest(77, 'ProgramNumericsThin.pas', 0, True, True, False);
     
     // ========================================
     // COMPILER - Compiler directives
     // ========================================
     LTester.AddTest(80, 'ProgramCompilerDirectives.pas', 0, True, True, False);
     LTester.AddTest(81, 'DirectiveTest.pas', 0, True, True, False);
+    LTester.AddTest(82, 'ProgramRuntimeChecks.pas', 0, True, True, False);
+    LTester.AddTest(83, 'ProgramRuntimeChecksOff.pas', 0, True, True, False);
     
     // ========================================
     // UNITS - Unit usage
@@ -10,9 +10,16 @@
 ===============================================================================}
 
 program ProgramArraySet;
+type
+  TColor = (Red, Green, Blue, Cyan, Magenta);
+  TColors = set of TColor;
 var
   arr: array of Integer;
   s: set of 0..9;
+  t: set of 0..9;
+  colors: TColors;
+  c: TColor;
+  ch: Char;
   i: Integer;
 begin
   // Test dynamic array
@@ -41,4 +48,40 @@ begin
   Exclude(s, 3);
   WriteLn('After Exclude(s, 3):');
   WriteLn('3 in s: ', 3 in s);
+  
+  // Set operators and literals
+  s := [1, 2, 5..7];
+  t := [2, 6, 9];
+  WriteLn('');
+  WriteLn('Set operators:');
+  WriteLn('9 in s + t: ', 9 in (s + t));
+  WriteLn('6 in s * t: ', 6 in (s * t));
+  WriteLn('1 in s * t: ', 1 in (s * t));
+  WriteLn('6 in s - t: ', 6 in (s - t));
+  WriteLn('[2, 6] <= t: ', [2, 6] <= t);
+  WriteLn('s >= t: ', s >= t);
+  WriteLn('s = [1, 2, 5, 6, 7]: ', s = [1, 2, 5, 6, 7]);
+  
+  // Sets take as many bytes as their range needs
+  colors := [Red, Blue];
+  Include(colors, Magenta);
+  WriteLn('Blue in colors: ', Blue in colors);
+  WriteLn('Green in colors: ', Green in colors);
+  WriteLn('SizeOf(TColors): ', SizeOf(TColors));
+  WriteLn('SizeOf(s): ', SizeOf(s));
+  
+  // Enumerate members in ascending order
+  WriteLn('Members of s:');
+  for i in s do
+    WriteLn(i);
+  WriteLn('Count(s): ', Count(s));
+  for c in colors do
+    WriteLn('Ord(c): ', Ord(c));
+  WriteLn('Count(colors): ', Count(colors));
+  
+  // Sets of literals are built at compile time
+  ch := 'q';
+  WriteLn('ch in [''a''..''z'', ''_'']: ', ch in ['a'..'z', '_']);
+  WriteLn('ch in [''A''..''Z'']: ', ch in ['A'..'Z']);
+  WriteLn('5 in [1, 3..6]: ', 5 in [1, 3..6]);
 end.
\ No newline at end of file
@@ -11,12 +11,18 @@
 
 program ProgramDynamicArrayAdvanced;
 
+function CompareDescending(const ALeft, ARight: Integer): Integer;
+begin
+  Result := ARight - ALeft;
+end;
+
 var
   LArray: array of Integer;
   LCopy1: array of Integer;
   LCopy2: array of Integer;
   LCopy3: array of Integer;
   LI: Integer;
+  LFound: Integer;
 
 begin
   WriteLn('=== Testing Advanced Dynamic Array Functions ===');
@@ -122,6 +128,113 @@ begin
   
   WriteLn();
   
+  { ============================================================================
+    Reference Semantics
+    ============================================================================ }
+  
+  WriteLn('--- Reference Semantics ---');
+  
+  { Assignment shares the array, as in Delphi }
+  LCopy2 := LArray;
+  LCopy2[0] := 99;
+  WriteLn('After LCopy2 := LArray; LCopy2[0] := 99');
+  WriteLn('LArray[0] = ', LArray[0], ' (shared, expected 99)');
+  
+  { SetLength makes the array unique }
+  SetLength(LCopy2, Length(LCopy2));
+  LCopy2[1] := 77;
+  WriteLn('After SetLength(LCopy2, ...); LCopy2[1] := 77');
+  WriteLn('LArray[1] = ', LArray[1], ' (unique, expected 20)');
+  WriteLn('LCopy2[1] = ', LCopy2[1]);
+  
+  { Copy without a range gives a unique copy of the whole array }
+  LCopy3 := Copy(LArray);
+  LCopy3[2] := 55;
+  WriteLn('After LCopy3 := Copy(LArray); LCopy3[2] := 55');
+  WriteLn('LArray[2] = ', LArray[2], ' (unique, expected 30)');
+  WriteLn('Length(LCopy3) = ', Length(LCopy3));
+  
+  WriteLn();
+  
+  { ============================================================================
+    Insert / Delete / Concat (Dynamic Array)
+    ============================================================================ }
+  
+  WriteLn('--- Insert / Delete / Concat (Dynamic Array) ---');
+  
+  SetLength(LCopy1, 3);
+  for LI := 0 to 2 do
+    LCopy1[LI] := LI + 1;
+  
+  { Insert one element, then a whole array }
+  Insert(100, LCopy1, 1);
+  Insert(LCopy1, LCopy1, 0);
+  Write('Insert(100, A, 1); Insert(A, A, 0): [');
+  for LI := 0 to High(LCopy1) do
+  begin
+    Write(LCopy1[LI]);
+    if LI < High(LCopy1) then
+      Write(', ');
+  end;
+  WriteLn(']');
+  
+  { Delete clamps the count to the end of the array }
+  Delete(LCopy1, 5, 10);
+  Write('Delete(A, 5, 10): [');
+  for LI := 0 to High(LCopy1) do
+  begin
+    Write(LCopy1[LI]);
+    if LI < High(LCopy1) then
+      Write(', ');
+  end;
+  WriteLn(']');
+  
+  { Concat builds a new array from its arguments }
+  LCopy2 := Concat(LCopy1, LCopy1, LCopy3);
+  WriteLn('Length(Concat(A, A, LCopy3)) = ', Length(LCopy2));
+  WriteLn('First/last: ', LCopy2[0], ' / ', LCopy2[High(LCopy2)]);
+  
+  WriteLn();
+  
+  { ============================================================================
+    TArray.Sort / TArray.BinarySearch
+    ============================================================================ }
+  
+  WriteLn('--- TArray.Sort / TArray.BinarySearch ---');
+  
+  SetLength(LArray, 8);
+  for LI := 0 to 7 do
+    LArray[LI] := (LI * 37) mod 11;
+  
+  TArray.Sort<Integer>(LArray);
+  Write('TArray.Sort(A): [');
+  for LI := 0 to High(LArray) do
+  begin
+    Write(LArray[LI]);
+    if LI < High(LArray) then
+      Write(', ');
+  end;
+  WriteLn(']');
+  
+  { BinarySearch finds the first match, or where the item would go }
+  if TArray.BinarySearch<Integer>(LArray, 4, LFound) then
+    WriteLn('BinarySearch(A, 4): found at ', LFound);
+  if not TArray.BinarySearch<Integer>(LArray, 7, LFound) then
+    WriteLn('BinarySearch(A, 7): not found, insert at ', LFound);
+  
+  { A comparer function returns <0, 0 or >0, as IComparer<T>.Compare }
+  TArray.Sort<Integer>(LArray, CompareDescending);
+  Write('TArray.Sort(A, CompareDescending): [');
+  for LI := 0 to High(LArray) do
+  begin
+    Write(LArray[LI]);
+    if LI < High(LArray) then
+      Write(', ');
+  end;
+  WriteLn(']');
+  
+  WriteLn();
+  
   { ============================================================================
     Summary
     ============================================================================ }
@@ -129,8 +242,11 @@ begin
   WriteLn('--- Summary ---');
   WriteLn('Dynamic array Copy function:');
   WriteLn('  - Copies subrange of dynamic array');
-  WriteLn('  - Parameters: Copy(source, index, count)');
-  WriteLn('  - Returns new independent array (COW behavior)');
+  WriteLn('  - Parameters: Copy(source, index, count) or Copy(source)');
+  WriteLn('  - Returns new independent array');
+  WriteLn('  - Assignment shares, SetLength makes unique');
+  WriteLn('  - Insert, Delete and Concat on dynamic arrays');
+  WriteLn('  - TArray.Sort and TArray.BinarySearch');
   WriteLn('  - Handles boundary conditions gracefully');
   WriteLn('  - Zero count returns empty array');
   
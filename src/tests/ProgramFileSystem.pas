@@ -102,6 +102,15 @@ begin
   LResult := FileExists('test_new.txt');
   WriteLn('New file exists: ', BoolToStr(LResult, True));
   
+  { A name edited in place is looked up again, not from the previous call }
+  LDir := 'test_new.txt';
+  LResult := FileExists(LDir);
+  WriteLn('FileExists(LDir) = ', BoolToStr(LResult, True));
+  Delete(LDir, 6, 3);
+  Insert('old', LDir, 6);
+  LResult := FileExists(LDir);
+  WriteLn('FileExists(LDir) after edit to ', LDir, ' = ', BoolToStr(LResult, True));
+  
   { Cleanup }
   RemoveFile('test_new.txt');
   
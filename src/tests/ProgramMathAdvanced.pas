@@ -15,6 +15,11 @@ var
   LX: Double;
   LY: Double;
   LZ: Double;
+  LData: array of Double;
+  LInts: array[0..4] of Integer;
+  LMean: Double;
+  LStdDev: Double;
+  LI: Integer;
 
 begin
   WriteLn('=== Testing Advanced Math Functions ===');
@@ -217,5 +222,55 @@ begin
   WriteLn('LogN(2,8) + LogN(2,4) = ', FloatToStr(LX + LY), ' = LogN(2,32) = ', FloatToStr(LZ));
   
   WriteLn();
+  
+  { ============================================================================
+    Array Statistics
+    ============================================================================ }
+  
+  WriteLn('--- Array Statistics ---');
+  
+  { 2, 4, 4, 4, 5, 5, 7, 9 }
+  SetLength(LData, 8);
+  LData[0] := 2.0;
+  LData[1] := 4.0;
+  LData[2] := 4.0;
+  LData[3] := 4.0;
+  LData[4] := 5.0;
+  LData[5] := 5.0;
+  LData[6] := 7.0;
+  LData[7] := 9.0;
+  WriteLn('Sum = ', FloatToStr(Sum(LData)), ' (should be 40)');
+  WriteLn('SumOfSquares = ', FloatToStr(SumOfSquares(LData)), ' (should be 232)');
+  WriteLn('MinValue = ', FloatToStr(MinValue(LData)), ' (should be 2)');
+  WriteLn('MaxValue = ', FloatToStr(MaxValue(LData)), ' (should be 9)');
+  WriteLn('Mean = ', FloatToStr(Mean(LData)), ' (should be 5)');
+  WriteLn('Variance = ', FloatToStr(Variance(LData)), ' (should be 4.57142857142857)');
+  MeanAndStdDev(LData, LMean, LStdDev);
+  WriteLn('MeanAndStdDev: Mean = ', FloatToStr(LMean), ', StdDev = ', FloatToStr(LStdDev));
+  WriteLn('StdDev = ', FloatToStr(StdDev(LData)));
+  
+  { Norm of (3, 4) }
+  SetLength(LData, 2);
+  LData[0] := 3.0;
+  LData[1] := 4.0;
+  WriteLn('Norm(3, 4) = ', FloatToStr(Norm(LData)), ' (should be 5)');
+  
+  { Long sum: 0.1 added 1000 times }
+  SetLength(LData, 1000);
+  for LI := 0 to 999 do
+    LData[LI] := 0.1;
+  WriteLn('Sum(1000 x 0.1) = ', FloatToStr(Sum(LData)), ' (should be 100)');
+  
+  { Integer arrays }
+  LInts[0] := 7;
+  LInts[1] := -3;
+  LInts[2] := 12;
+  LInts[3] := 0;
+  LInts[4] := 4;
+  WriteLn('SumInt = ', SumInt(LInts), ' (should be 20)');
+  WriteLn('MinIntValue = ', MinIntValue(LInts), ' (should be -3)');
+  WriteLn('MaxIntValue = ', MaxIntValue(LInts), ' (should be 12)');
+  WriteLn('Mean = ', FloatToStr(Mean(LInts)), ' (should be 4)');
+  
   WriteLn('✓ All advanced math functions tested successfully');
 end.
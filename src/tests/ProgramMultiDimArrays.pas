@@ -13,6 +13,10 @@ program ProgramMultiDimArrays;
 var
   Matrix: array[0..2, 0..2] of Integer;
   Cube: array[0..1, 0..1, 0..1] of Integer;
+  Grid: TMatrix<Double>;
+  GridCopy: TMatrix<Double>;
+  Rect: array of array of Integer;
+  Triangle: array of array of Integer;
   I, J, K: Integer;
   Sum: Integer;
 begin
@@ -47,5 +51,45 @@ begin
       end;
   
   WriteLn('Sum of all cube elements: ', Sum);
+  
+  WriteLn('--- Dense Dynamic 2D Array (3x4 TMatrix) ---');
+  SetLength(Grid, 3, 4);
+  WriteLn('Length(Grid) = ', Length(Grid), ', Length(Grid[0]) = ', Length(Grid[0]));
+  WriteLn('High(Grid) = ', High(Grid), ', High(Grid[0]) = ', High(Grid[0]));
+  for I := 0 to High(Grid) do
+    for J := 0 to High(Grid[I]) do
+      Grid[I, J] := I * 10 + J;
+  WriteLn('Grid[2, 3] = ', Grid[2, 3]);
+  
+  { Assignment shares the grid; SetLength keeps the overlapping block }
+  GridCopy := Grid;
+  SetLength(GridCopy, 4, 2);
+  GridCopy[0, 0] := -1;
+  WriteLn('After SetLength(GridCopy, 4, 2): ', Length(GridCopy), 'x', Length(GridCopy[0]));
+  WriteLn('GridCopy[2, 1] = ', GridCopy[2, 1], ', GridCopy[3, 1] = ', GridCopy[3, 1]);
+  WriteLn('Grid[0, 0] = ', Grid[0, 0], ' (unchanged)');
+  
+  WriteLn('--- Nested Dynamic 2D Array (2x3, rows are separate arrays) ---');
+  SetLength(Rect, 2, 3);
+  Rect[1, 2] := 5;
+  Rect[0] := Rect[1];
+  SetLength(Rect[1], 1);
+  WriteLn('Rect[0, 2] = ', Rect[0, 2], ', Length(Rect[1]) = ', Length(Rect[1]));
+  
+  WriteLn('--- Jagged Dynamic Array (rows sized one by one) ---');
+  SetLength(Triangle, 4);
+  for I := 0 to High(Triangle) do
+  begin
+    SetLength(Triangle[I], I + 1);
+    for J := 0 to High(Triangle[I]) do
+      Triangle[I][J] := I + J;
+  end;
+  Sum := 0;
+  for I := 0 to High(Triangle) do
+    for J := 0 to High(Triangle[I]) do
+      Sum := Sum + Triangle[I, J];
+  WriteLn('Length(Triangle[0]) = ', Length(Triangle[0]), ', Length(Triangle[3]) = ', Length(Triangle[3]));
+  WriteLn('Sum of triangle elements: ', Sum);
+  
   WriteLn('✓ Multi-dimensional arrays tested');
 end.
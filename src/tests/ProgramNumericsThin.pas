@@ -0,0 +1,108 @@
+﻿{===============================================================================
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+===============================================================================}
+
+{$NUMERICS THIN}
+
+program ProgramNumericsThin;
+
+var
+  LInt: Integer;
+  LInt64: Int64;
+  LCard: Cardinal;
+  LByte: Byte;
+  LWord: Word;
+  LDouble: Double;
+  LSingle: Single;
+  LSum: Integer;
+  LTotal: Int64;
+  LData: array of Integer;
+  I: Integer;
+
+begin
+  WriteLn('=== Testing Thin Numerics ===');
+  WriteLn();
+  
+  { ============================================================================
+    Arithmetic and comparisons give the same results as WRAPPED
+    ============================================================================ }
+  
+  WriteLn('--- Integer ---');
+  
+  LInt := 17;
+  WriteLn('17 + 5 = ', LInt + 5);
+  WriteLn('17 - 5 = ', LInt - 5);
+  WriteLn('17 * 5 = ', LInt * 5);
+  WriteLn('17 div 5 = ', LInt div 5);
+  WriteLn('17 mod 5 = ', LInt mod 5);
+  WriteLn('-17 div 5 = ', -LInt div 5);
+  WriteLn('-17 mod 5 = ', -LInt mod 5);
+  WriteLn('17 shl 2 = ', LInt shl 2);
+  WriteLn('17 and 3 = ', LInt and 3);
+  WriteLn('17 < 20: ', LInt < 20);
+  WriteLn('17 >= 17: ', LInt >= 17);
+  WriteLn('17 > 17: ', LInt > 17);
+  Inc(LInt);
+  Dec(LInt, 3);
+  WriteLn('Inc then Dec(3): ', LInt);
+  
+  WriteLn();
+  WriteLn('--- Int64 and Cardinal ---');
+  
+  LInt64 := 3000000000;
+  LInt64 := LInt64 * 3;
+  WriteLn('3000000000 * 3 = ', LInt64);
+  LCard := 4294967295;
+  WriteLn('High(Cardinal) = ', LCard);
+  LInt64 := LCard;
+  LInt64 := LInt64 + LInt;
+  WriteLn('High(Cardinal) + 15 as Int64 = ', LInt64);
+  
+  WriteLn();
+  WriteLn('--- Byte and Word wrap around ---');
+  
+  LByte := 255;
+  Inc(LByte);
+  WriteLn('Inc(255) as Byte = ', LByte);
+  LWord := 0;
+  Dec(LWord);
+  WriteLn('Dec(0) as Word = ', LWord);
+  
+  WriteLn();
+  WriteLn('--- Double and Single ---');
+  
+  LDouble := 1.5;
+  LDouble := LDouble * 4 + 0.25;
+  WriteLn('1.5 * 4 + 0.25 = ', LDouble);
+  LSingle := 2.5;
+  WriteLn('Single / 2 = ', LSingle / 2);
+  WriteLn('Trunc(6.25) = ', Trunc(LDouble));
+  WriteLn('Round(6.25) = ', Round(LDouble));
+  WriteLn('6.25 > 6: ', LDouble > 6);
+  
+  WriteLn();
+  WriteLn('--- Loop kernel ---');
+  
+  SetLength(LData, 1000);
+  for I := 0 to High(LData) do
+    LData[I] := I;
+  LSum := 0;
+  LTotal := 0;
+  for I := 0 to High(LData) do
+  begin
+    LSum := LSum + LData[I];
+    LTotal := LTotal + LData[I] * LData[I];
+  end;
+  WriteLn('Sum 0..999 = ', LSum);
+  WriteLn('Sum of squares 0..999 = ', LTotal);
+  
+  WriteLn();
+  WriteLn('✓ Thin numerics tested');
+end.
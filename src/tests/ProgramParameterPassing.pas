@@ -40,8 +40,39 @@ begin
   WriteLn('  ByOut - set to: ', AValue);
 end;
 
+function SumOpen(const AValues: array of Double): Double;
+var
+  I: Integer;
+begin
+  Result := 0.0;
+  for I := Low(AValues) to High(AValues) do
+    Result := Result + AValues[I];
+end;
+
+function CountOpen(AValues: array of Integer): Integer;
+begin
+  Result := Length(AValues);
+end;
+
+function ZeroFirstOpen(AValues: array of Integer): Integer;
+begin
+  AValues[0] := 0;
+  Result := AValues[0] + AValues[High(AValues)];
+end;
+
+procedure FillOpen(var AValues: array of Integer; const AValue: Integer);
+var
+  I: Integer;
+begin
+  for I := 0 to High(AValues) do
+    AValues[I] := AValue;
+end;
+
 var
   V: Integer;
+  LDyn: array of Integer;
+  LStatic: array[0..3] of Integer;
+  LDoubles: array of Double;
 begin
   WriteLn('=== Testing Parameter Passing ===');
   
@@ -64,5 +95,21 @@ begin
   ByOut(V);
   WriteLn('After ByOut: ', V);
   
+  WriteLn('Open array parameters:');
+  SetLength(LDoubles, 3);
+  LDoubles[0] := 1.5;
+  LDoubles[1] := 2.5;
+  LDoubles[2] := 3.0;
+  WriteLn('  SumOpen(dynamic): ', FloatToStr(SumOpen(LDoubles)));
+  WriteLn('  SumOpen(literal): ', FloatToStr(SumOpen([0.5, 1.5, 2.0])));
+  SetLength(LDyn, 5);
+  FillOpen(LDyn, 7);
+  WriteLn('  FillOpen(dynamic): ', LDyn[0], ' ', LDyn[4]);
+  FillOpen(LStatic, 9);
+  WriteLn('  FillOpen(static): ', LStatic[0], ' ', LStatic[3]);
+  WriteLn('  CountOpen: ', CountOpen(LDyn), ' ', CountOpen(LStatic), ' ', CountOpen([1, 2, 3]));
+  WriteLn('  ZeroFirstOpen(dynamic): ', ZeroFirstOpen(LDyn), ' caller keeps ', LDyn[0]);
+  WriteLn('  ZeroFirstOpen(literal): ', ZeroFirstOpen([4, 5, 6]));
+  
   WriteLn('✓ All parameter passing modes tested');
 end.
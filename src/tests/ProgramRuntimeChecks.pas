@@ -0,0 +1,200 @@
+﻿{===============================================================================
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+===============================================================================}
+
+{$OVERFLOWCHECKS ON}
+{$RANGECHECKS ON}
+
+program ProgramRuntimeChecks;
+
+{
+  Verifies that OVERFLOWCHECKS ON raises EOverflow and RANGECHECKS ON raises
+  ERangeError. Any missing exception halts with exit code 1.
+}
+
+var
+  LInt: Integer;
+  LDivisor: Integer;
+  LInt64: Int64;
+  LIndex: Integer;
+  LValues: array of Integer;
+  LStatic: array[0..4] of Integer;
+  LText: String;
+  LDigits: set of 0..9;
+  LRaised: Boolean;
+
+procedure Check(const AWhat: String; const AOk: Boolean);
+begin
+  if AOk then
+    WriteLn('✓ ', AWhat)
+  else
+  begin
+    WriteLn('✗ ', AWhat);
+    Halt(1);
+  end;
+end;
+
+function IsOverflow(): Boolean;
+begin
+  Result := Pos('Arithmetic overflow', GetExceptionMessage()) = 1;
+end;
+
+function IsRangeError(): Boolean;
+begin
+  Result := Pos('Range check error', GetExceptionMessage()) = 1;
+end;
+
+function PeekOpen(const AValues: array of Integer; const AIndex: Integer): Integer;
+begin
+  Result := AValues[AIndex];
+end;
+
+begin
+  WriteLn('=== Testing Runtime Checks ===');
+  WriteLn();
+  
+  { ============================================================================
+    Overflow checks
+    ============================================================================ }
+  
+  WriteLn('--- Overflow Checks ---');
+  
+  LInt := 2147483647;
+  LRaised := False;
+  try
+    LInt := LInt + 1;
+  except
+    LRaised := IsOverflow();
+  end;
+  Check('High(Integer) + 1 raises EOverflow', LRaised);
+  
+  LInt := 65536;
+  LRaised := False;
+  try
+    LInt := LInt * LInt;
+  except
+    LRaised := IsOverflow();
+  end;
+  Check('65536 * 65536 as Integer raises EOverflow', LRaised);
+  
+  LInt := -2147483648;
+  LRaised := False;
+  try
+    Dec(LInt);
+  except
+    LRaised := IsOverflow();
+  end;
+  Check('Dec(Low(Integer)) raises EOverflow', LRaised);
+  
+  LInt64 := 9223372036854775807;
+  LRaised := False;
+  try
+    Inc(LInt64);
+  except
+    LRaised := IsOverflow();
+  end;
+  Check('Inc(High(Int64)) raises EOverflow', LRaised);
+  
+  LInt := -2147483648;
+  LDivisor := -1;
+  LRaised := False;
+  try
+    LInt := LInt div LDivisor;
+  except
+    LRaised := IsOverflow();
+  end;
+  Check('Low(Integer) div -1 raises EOverflow', LRaised);
+  
+  { mod -1 is always 0 and must not fault }
+  LInt := -2147483648;
+  Check('Low(Integer) mod -1 = 0', LInt mod LDivisor = 0);
+  LInt64 := -9223372036854775807;
+  Dec(LInt64);
+  Check('Low(Int64) mod -1 = 0', LInt64 mod LDivisor = 0);
+  
+  LInt := 2147483646;
+  Inc(LInt);
+  Check('High(Integer) - 1 + 1 does not raise', LInt = 2147483647);
+  
+  WriteLn();
+  
+  { ============================================================================
+    Range checks
+    ============================================================================ }
+  
+  WriteLn('--- Range Checks ---');
+  
+  SetLength(LValues, 5);
+  LIndex := 5;
+  LRaised := False;
+  try
+    LValues[LIndex] := 1;
+  except
+    LRaised := IsRangeError();
+  end;
+  Check('Dynamic array index 5 of 0..4 raises ERangeError', LRaised);
+  
+  LIndex := -1;
+  LRaised := False;
+  try
+    LInt := LValues[LIndex];
+  except
+    LRaised := IsRangeError();
+  end;
+  Check('Dynamic array index -1 raises ERangeError', LRaised);
+  
+  LIndex := 5;
+  LRaised := False;
+  try
+    LStatic[LIndex] := 1;
+  except
+    LRaised := IsRangeError();
+  end;
+  Check('Static array index 5 of 0..4 raises ERangeError', LRaised);
+  
+  LRaised := False;
+  try
+    LInt := PeekOpen(LValues, LIndex);
+  except
+    LRaised := IsRangeError();
+  end;
+  Check('Open array index 5 of 0..4 raises ERangeError', LRaised);
+  
+  LText := 'abc';
+  LIndex := 0;
+  LRaised := False;
+  try
+    LInt := Ord(LText[LIndex]);
+  except
+    LRaised := IsRangeError();
+  end;
+  Check('String index 0 of 1..3 raises ERangeError', LRaised);
+  
+  LInt := 20;
+  LRaised := False;
+  try
+    LDigits := [1, LInt];
+  except
+    LRaised := IsRangeError();
+  end;
+  Check('Set member 20 stored in set of 0..9 raises ERangeError', LRaised);
+  
+  LInt := 9;
+  LDigits := [1, LInt];
+  Check('In-range set members do not raise', 9 in LDigits);
+  
+  LIndex := 4;
+  LValues[LIndex] := 7;
+  LStatic[LIndex] := 8;
+  Check('In-range indexes do not raise', (PeekOpen(LValues, LIndex) = 7) and (LStatic[LIndex] = 8) and (LText[3] = 'c'));
+  
+  WriteLn();
+  WriteLn('✓ Runtime checks tested');
+end.
@@ -0,0 +1,89 @@
+﻿{===============================================================================
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+===============================================================================}
+
+{$OVERFLOWCHECKS OFF}
+{$RANGECHECKS OFF}
+
+program ProgramRuntimeChecksOff;
+
+{
+  Verifies that with OVERFLOWCHECKS OFF (the default) Integer and Int64
+  arithmetic wraps around as in Delphi instead of raising EOverflow, that
+  in-range indexing behaves the same as with checks on, and that set members
+  outside the target range are dropped. Out-of-range indexes
+  are not exercised: unchecked, they read or write outside the array.
+  Any exception halts with exit code 1.
+}
+
+var
+  LInt: Integer;
+  LDivisor: Integer;
+  LInt64: Int64;
+  LIndex: Integer;
+  LValues: array of Integer;
+  LText: String;
+  LDigits: set of 0..9;
+  LRaised: Boolean;
+
+procedure Check(const AWhat: String; const AOk: Boolean);
+begin
+  if AOk then
+    WriteLn('✓ ', AWhat)
+  else
+  begin
+    WriteLn('✗ ', AWhat);
+    Halt(1);
+  end;
+end;
+
+begin
+  WriteLn('=== Testing Runtime Checks Off ===');
+  WriteLn();
+  
+  LRaised := False;
+  try
+    LInt := 2147483647;
+    LInt := LInt + 1;
+    Check('High(Integer) + 1 wraps to Low(Integer)', LInt = -2147483648);
+    
+    LInt := 65536;
+    LInt := LInt * LInt;
+    Check('65536 * 65536 as Integer wraps to 0', LInt = 0);
+    
+    LInt := -2147483648;
+    Dec(LInt);
+    Check('Dec(Low(Integer)) wraps to High(Integer)', LInt = 2147483647);
+    
+    LInt64 := 9223372036854775807;
+    Inc(LInt64);
+    Check('Inc(High(Int64)) wraps to Low(Int64)', LInt64 < 0);
+    
+    LInt := -7;
+    LDivisor := 2;
+    Check('-7 div 2 = -3 and -7 mod 2 = -1', (LInt div LDivisor = -3) and (LInt mod LDivisor = -1));
+    
+    SetLength(LValues, 5);
+    for LIndex := 0 to High(LValues) do
+      LValues[LIndex] := LIndex * 2;
+    LText := 'abc';
+    Check('In-range indexes read back', (LValues[4] = 8) and (LText[1] = 'a') and (LText[3] = 'c'));
+    
+    LInt := 20;
+    LDigits := [1, LInt];
+    Check('Set member 20 is dropped from set of 0..9', (1 in LDigits) and not (9 in LDigits));
+  except
+    LRaised := True;
+  end;
+  Check('No exception with checks off', not LRaised);
+  
+  WriteLn();
+  WriteLn('✓ Runtime checks off tested');
+end.
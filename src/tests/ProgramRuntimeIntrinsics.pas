@@ -119,6 +119,19 @@ begin
   Delete(LS, 7, 10);
   WriteLn('Delete("Hello Beautiful World", 7, 10) = "', LS, '"');
   
+  { Delete/Insert - Delphi range handling and copy-on-write }
+  LS := 'Hello World';
+  LS2 := LS;
+  Delete(LS, 6, 100);
+  WriteLn('Delete("Hello World", 6, 100) = "', LS, '"');
+  WriteLn('Original copy after Delete = "', LS2, '"');
+  Delete(LS, 0, 2);
+  WriteLn('Delete("Hello", 0, 2) = "', LS, '"');
+  Insert('!', LS, 100);
+  WriteLn('Insert("!", "Hello", 100) = "', LS, '"');
+  Insert(LS, LS, 1);
+  WriteLn('Insert(LS, LS, 1) = "', LS, '"');
+  
   { Pos - Find substring position }
   LS := 'Hello World';
   LI := Pos('World', LS);
@@ -135,6 +148,28 @@ begin
   LS2 := Copy(LS, 7, 5);
   WriteLn('Copy("Hello World", 7, 5) = "', LS2, '"');
   
+  { Copy - Out-of-range arguments, slices used without storing them }
+  LS2 := Copy(LS, 7, 100);
+  WriteLn('Copy("Hello World", 7, 100) = "', LS2, '"');
+  LS2 := Copy(LS, 20, 5);
+  WriteLn('Copy("Hello World", 20, 5) = "', LS2, '"');
+  if Copy(LS, 1, 5) = 'Hello' then
+    WriteLn('Copy("Hello World", 1, 5) = "Hello" matches');
+  WriteLn('Length(Trim(Copy("Hello World", 6, 3))) = ', Length(Trim(Copy(LS, 6, 3))));
+  LS := Copy(LS, 7, 5) + '!';
+  WriteLn('Copy("Hello World", 7, 5) + "!" = "', LS, '"');
+  
+  { Copy/Trim of temporaries - the slice keeps the temporary's buffer alive }
+  LS2 := 'Hello';
+  LS3 := ' World ';
+  LS := Copy(LS2 + LS3, 4, 5);
+  WriteLn('Copy("Hello" + " World ", 4, 5) = "', LS, '"');
+  LS := Trim(LS2 + LS3 + LS3);
+  WriteLn('Trim("Hello" + " World " + " World ") = "', LS, '"');
+  WriteLn('Copy(Trim(" World " + "Hello"), 3, 6) = "', Copy(Trim(LS3 + LS2), 3, 6), '"');
+  LS := Copy(IntToStr(1234567), 3, 3);
+  WriteLn('Copy(IntToStr(1234567), 3, 3) = "', LS, '"');
+  
   WriteLn();
   
   { ============================================================================
@@ -17,6 +17,7 @@ var
   LS3: String;
   LI: Integer;
   LBool: Boolean;
+  LSB: TStringBuilder;
 
 begin
   WriteLn('=== Testing Additional String Functions ===');
@@ -46,6 +47,24 @@ begin
   WriteLn('StringReplace("Hello World", "", "X"):');
   WriteLn('  Result: "', LS2, '" (no change expected)');
   
+  { Flags: first match only, then case-insensitive }
+  LS := 'foo bar FOO baz Foo';
+  LS2 := StringReplace(LS, 'foo', 'test', []);
+  WriteLn('StringReplace("foo bar FOO baz Foo", "foo", "test", []):');
+  WriteLn('  Result: "', LS2, '"');
+  LS2 := StringReplace(LS, 'foo', 'test', [rfReplaceAll]);
+  WriteLn('StringReplace("foo bar FOO baz Foo", "foo", "test", [rfReplaceAll]):');
+  WriteLn('  Result: "', LS2, '"');
+  LS2 := StringReplace(LS, 'FOO', 'test', [rfReplaceAll, rfIgnoreCase]);
+  WriteLn('StringReplace("foo bar FOO baz Foo", "FOO", "test", [rfReplaceAll, rfIgnoreCase]):');
+  WriteLn('  Result: "', LS2, '"');
+  
+  { rfIgnoreCase folds non-ASCII letters too, like AnsiSameText }
+  LS := 'Ärger ÄRGER ärger';
+  LS2 := StringReplace(LS, 'äRGER', 'x', [rfReplaceAll, rfIgnoreCase]);
+  WriteLn('StringReplace("Ärger ÄRGER ärger", "äRGER", "x", [rfReplaceAll, rfIgnoreCase]):');
+  WriteLn('  Result: "', LS2, '"');
+  
   WriteLn();
   
   { ============================================================================
@@ -111,6 +130,32 @@ begin
   
   WriteLn();
   
+  { ============================================================================
+    ANSIUPPERCASE / ANSILOWERCASE / ANSISAMETEXT
+    ============================================================================ }
+  
+  WriteLn('--- AnsiUpperCase / AnsiLowerCase / AnsiSameText ---');
+  
+  { UpperCase only maps ASCII letters; the Ansi versions map all of them }
+  LS := 'Grüße aus Köln, Ελληνικά';
+  WriteLn('UpperCase = ', UpperCase(LS));
+  WriteLn('AnsiUpperCase = ', AnsiUpperCase(LS));
+  WriteLn('AnsiLowerCase = ', AnsiLowerCase(LS));
+  
+  LBool := SameText('ÉTÉ', 'été');
+  if LBool then
+    WriteLn('SameText("ÉTÉ", "été") = true')
+  else
+    WriteLn('SameText("ÉTÉ", "été") = false (ASCII only)');
+  
+  LBool := AnsiSameText('ÉTÉ', 'été');
+  if LBool then
+    WriteLn('AnsiSameText("ÉTÉ", "été") = true')
+  else
+    WriteLn('AnsiSameText("ÉTÉ", "été") = false');
+  
+  WriteLn();
+  
   { ============================================================================
     QUOTEDSTR
     ============================================================================ }
@@ -137,6 +182,43 @@ begin
   LS2 := QuotedStr(LS);
   WriteLn('QuotedStr("Test 123!") = ', LS2);
   
+  WriteLn();
+  
+  { ============================================================================
+    CONCATENATION AND TSTRINGBUILDER
+    ============================================================================ }
+  
+  WriteLn('--- Concatenation ---');
+  
+  { A chain is built in one buffer }
+  LS := 'Blaise';
+  LS2 := 'Pascal';
+  LI := 42;
+  LS3 := LS + ', ' + LS2 + ' = ' + IntToStr(LI);
+  WriteLn('Chain = ', LS3);
+  
+  { S := S + X appends in place }
+  LS3 := '';
+  for LI := 1 to 5 do
+    LS3 := LS3 + IntToStr(LI) + ';';
+  WriteLn('Loop = ', LS3);
+  
+  WriteLn('--- TStringBuilder ---');
+  
+  LSB.Append('Items:');
+  for LI := 1 to 3 do
+  begin
+    LSB.Append(' ');
+    LSB.Append(LI);
+  end;
+  LSB.Insert(0, '[');
+  LSB.Append(']');
+  WriteLn('ToString = ', LSB.ToString());
+  WriteLn('Length = ', LSB.Length());
+  LSB.Clear();
+  LSB.Append(LS + LS2);
+  WriteLn('After Clear = ', LSB.ToString());
+  
   WriteLn();
   WriteLn('✓ All additional string functions tested successfully');
 end.
@@ -10,10 +10,17 @@
 ===============================================================================}
 
 program ProgramStringOperations;
+
+function Exclaim(const AText: String): String;
+begin
+  Result := AText + '!';
+end;
+
 var
   S1, S2, S3: String;
   Len: Integer;
   Ch: Char;
+  I: Integer;
 begin
   WriteLn('=== Testing String Operations ===');
   
@@ -45,5 +52,14 @@ begin
   Ch := S3[7];
   WriteLn('S3[7] = ', Ch);
   
+  WriteLn('--- Repeated literals ---');
+  for I := 1 to 3 do
+  begin
+    S3 := 'Hi';
+    S3 := S3 + '?';
+  end;
+  WriteLn('S3 = ', S3, ' (appending never changes the literal)');
+  WriteLn('Exclaim = ', Exclaim('Hey'));
+  
   WriteLn('✓ String operations tested');
 end.
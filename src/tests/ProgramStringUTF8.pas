@@ -0,0 +1,75 @@
+﻿{===============================================================================
+  Blaise Pascal™ - Think in Pascal. Compile to C++
+
+  Copyright © 2025-present tinyBigGAMES™ LLC
+  All Rights Reserved.
+
+  https://github.com/tinyBigGAMES/BlaisePascal
+
+  See LICENSE for license information
+===============================================================================}
+
+{$STRING_ENCODING UTF8}
+
+program ProgramStringUTF8;
+
+var
+  LStr: String;
+  LName: String;
+  LLine: String;
+  LPos: Integer;
+
+begin
+  WriteLn('=== Testing UTF-8 String Encoding ===');
+  WriteLn();
+  
+  { ============================================================================
+    ASCII text behaves exactly as in UTF-16 mode
+    ============================================================================ }
+  
+  WriteLn('--- ASCII ---');
+  
+  LStr := 'Hello, World';
+  WriteLn('String: ', LStr);
+  WriteLn('Length: ', Length(LStr));
+  WriteLn('LStr[1]: ', LStr[1]);
+  WriteLn('Copy(LStr, 8, 5): ', Copy(LStr, 8, 5));
+  WriteLn('Pos(''World'', LStr): ', Pos('World', LStr));
+  WriteLn('UpperCase: ', UpperCase(LStr));
+  
+  WriteLn();
+  
+  { ============================================================================
+    Non-ASCII text counts UTF-8 bytes
+    ============================================================================ }
+  
+  WriteLn('--- Non-ASCII ---');
+  
+  LName := 'Café';
+  WriteLn('String: ', LName);
+  WriteLn('Length (bytes): ', Length(LName));
+  LStr := 'Über ' + LName + ' 日本';
+  WriteLn('Concatenated: ', LStr);
+  WriteLn('Length (bytes): ', Length(LStr));
+  LPos := Pos(LName, LStr);
+  WriteLn('Pos(LName, LStr): ', LPos);
+  WriteLn('Copy(LStr, LPos, Length(LName)): ', Copy(LStr, LPos, Length(LName)));
+  WriteLn('LName = ''Café'': ', LName = 'Café');
+  
+  WriteLn();
+  
+  { ============================================================================
+    Building and scanning lines
+    ============================================================================ }
+  
+  WriteLn('--- Lines ---');
+  
+  LLine := '[ERROR] GET /naïve/path TOOK=93';
+  WriteLn('Line: ', LLine);
+  WriteLn('Pos(''ERROR'', LLine): ', Pos('ERROR', LLine));
+  WriteLn('Copy from GET: ', Copy(LLine, Pos('GET ', LLine), Length(LLine)));
+  WriteLn('Trim: "', Trim('  ' + LName + '  '), '"');
+  
+  WriteLn();
+  WriteLn('=== All UTF-8 String Tests Complete ===');
+end.